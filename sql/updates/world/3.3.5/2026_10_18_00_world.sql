@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name`='debug opcodestats';
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+('debug opcodestats',300,'Syntax: .debug opcodestats [#count]\r\n\r\nLists the #count (default 10) client opcode handlers with the highest total handling time, with their call count, average, p50, p99 and max latency. Requires Network.OpcodeStats to be enabled.');
@@ -184,6 +184,7 @@ namespace MMAP
         if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->tileGraph.AddTile(mmap->navMesh, tileRef);
             ++loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02}, {:02}] into {:03}[{:02}, {:02}]", mapId, x, y, mapId, header->x, header->y);
             return true;
@@ -245,6 +246,9 @@ namespace MMAP
         }
 
         dtTileRef tileRef = mmap->loadedTileRefs[packedGridPos];
+        dtMeshHeader const* header = mmap->navMesh->getTileByRef(tileRef)->header;
+        int32 tileX = header->x;
+        int32 tileY = header->y;
 
         // unload, and mark as non loaded
         if (dtStatusFailed(mmap->navMesh->removeTile(tileRef, nullptr, nullptr)))
@@ -258,6 +262,7 @@ namespace MMAP
         else
         {
             mmap->loadedTileRefs.erase(packedGridPos);
+            mmap->tileGraph.RemoveTile(mmap->navMesh, tileX, tileY);
             --loadedTiles;
             TC_LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02}, {:02}] from {:03}", mapId, x, y, mapId);
             return true;
@@ -333,6 +338,15 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    bool MMapManager::FindTileRoute(uint32 mapId, float const* startPos, float const* endPos, TileRoute& route) const
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+            return false;
+
+        return itr->second->tileGraph.FindRoute(itr->second->navMesh, startPos, endPos, route);
+    }
+
     dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
     {
         auto itr = GetMMapData(mapId);
@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
+#include "MMapTileGraph.h"
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -49,6 +50,7 @@ namespace MMAP
 
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
+        TileGraph tileGraph;               // portals between the loaded tiles
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
@@ -72,6 +74,9 @@ namespace MMAP
             dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
             dtNavMesh const* GetNavMesh(uint32 mapId);
 
+            // coarse route over the portals between loaded tiles, see TileGraph::FindRoute
+            bool FindTileRoute(uint32 mapId, float const* startPos, float const* endPos, TileRoute& route) const;
+
             uint32 getLoadedTilesCount() const { return loadedTiles; }
             uint32 getLoadedMapsCount() const { return uint32(loadedMMaps.size()); }
         private:
@@ -0,0 +1,210 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MMapTileGraph.h"
+#include "DetourCommon.h"
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <queue>
+
+namespace MMAP
+{
+    // portals closer than this to an already known portal into the same tile add nothing to the coarse search
+    constexpr float PORTAL_SPACING = 16.0f;
+    // bounds the coarse search when the destination can't be reached through the loaded tiles
+    constexpr uint32 MAX_ROUTE_NODES = 4096;
+
+    void TileGraph::AddTile(dtNavMesh const* navMesh, dtTileRef tileRef)
+    {
+        dtMeshTile const* tile = navMesh->getTileByRef(tileRef);
+        if (!tile || !tile->header)
+            return;
+
+        std::unique_lock<std::shared_mutex> lock(_lock);
+        for (int32 x = tile->header->x - 1; x <= tile->header->x + 1; ++x)
+            for (int32 y = tile->header->y - 1; y <= tile->header->y + 1; ++y)
+                BuildPortals(navMesh, x, y);
+    }
+
+    void TileGraph::RemoveTile(dtNavMesh const* navMesh, int32 tileX, int32 tileY)
+    {
+        std::unique_lock<std::shared_mutex> lock(_lock);
+        _portals.erase(PackTile(tileX, tileY));
+
+        for (int32 x = tileX - 1; x <= tileX + 1; ++x)
+            for (int32 y = tileY - 1; y <= tileY + 1; ++y)
+                if (x != tileX || y != tileY)
+                    BuildPortals(navMesh, x, y);
+    }
+
+    void TileGraph::BuildPortals(dtNavMesh const* navMesh, int32 tileX, int32 tileY)
+    {
+        dtMeshTile const* tile = navMesh->getTileAt(tileX, tileY, 0);
+        if (!tile || !tile->header)
+        {
+            _portals.erase(PackTile(tileX, tileY));
+            return;
+        }
+
+        std::vector<Portal>& portals = _portals[PackTile(tileX, tileY)];
+        portals.clear();
+
+        for (int32 i = 0; i < tile->header->polyCount; ++i)
+        {
+            dtPoly const* poly = &tile->polys[i];
+            if (poly->getType() == DT_POLYTYPE_OFFMESH_CONNECTION)
+                continue;
+
+            for (uint32 j = poly->firstLink; j != DT_NULL_LINK; j = tile->links[j].next)
+            {
+                dtLink const& link = tile->links[j];
+                if (link.side == 0xFF) // link inside this tile
+                    continue;
+
+                dtMeshTile const* neighbour = nullptr;
+                dtPoly const* neighbourPoly = nullptr;
+                if (dtStatusFailed(navMesh->getTileAndPolyByRef(link.ref, &neighbour, &neighbourPoly)))
+                    continue;
+
+                Portal portal;
+                portal.NeighbourTile = PackTile(neighbour->header->x, neighbour->header->y);
+                float const* v0 = &tile->verts[poly->verts[link.edge] * 3];
+                float const* v1 = &tile->verts[poly->verts[(link.edge + 1) % poly->vertCount] * 3];
+                dtVlerp(portal.Position, v0, v1, 0.5f);
+
+                bool known = std::any_of(portals.begin(), portals.end(), [&portal](Portal const& other)
+                {
+                    return other.NeighbourTile == portal.NeighbourTile && dtVdistSqr(other.Position, portal.Position) < PORTAL_SPACING * PORTAL_SPACING;
+                });
+
+                if (!known)
+                    portals.push_back(portal);
+            }
+        }
+    }
+
+    bool TileGraph::FindRoute(dtNavMesh const* navMesh, float const* startPos, float const* endPos, TileRoute& route) const
+    {
+        int32 startX, startY, endX, endY;
+        navMesh->calcTileLoc(startPos, &startX, &startY);
+        navMesh->calcTileLoc(endPos, &endX, &endY);
+
+        uint32 startTile = PackTile(startX, startY);
+        uint32 endTile = PackTile(endX, endY);
+        if (startTile == endTile)
+            return false;
+
+        std::shared_lock<std::shared_mutex> lock(_lock);
+        auto startItr = _portals.find(startTile);
+        if (startItr == _portals.end() || !_portals.count(endTile))
+            return false;
+
+        // nodes are portals, identified by (tile << 32 | index in the portal list of the tile)
+        constexpr uint64 GOAL_NODE = std::numeric_limits<uint64>::max();
+        constexpr uint64 NO_NODE = GOAL_NODE - 1;
+
+        struct OpenNode
+        {
+            float EstimatedTotal;
+            uint64 Id;
+
+            bool operator<(OpenNode const& right) const { return EstimatedTotal > right.EstimatedTotal; }
+        };
+
+        struct NodeInfo
+        {
+            float Cost;
+            uint64 Previous;
+        };
+
+        std::priority_queue<OpenNode> open;
+        std::unordered_map<uint64, NodeInfo> nodes;
+
+        auto getPortal = [this](uint64 id) -> Portal const&
+        {
+            return _portals.find(uint32(id >> 32))->second[uint32(id)];
+        };
+
+        auto push = [&](uint64 id, float cost, uint64 previous, float heuristic)
+        {
+            auto [itr, inserted] = nodes.try_emplace(id, NodeInfo{ cost, previous });
+            if (!inserted)
+            {
+                if (itr->second.Cost <= cost)
+                    return;
+
+                itr->second = { cost, previous };
+            }
+
+            open.push({ cost + heuristic, id });
+        };
+
+        for (uint32 i = 0; i < startItr->second.size(); ++i)
+        {
+            float const* position = startItr->second[i].Position;
+            push(uint64(startTile) << 32 | i, dtVdist(startPos, position), NO_NODE, dtVdist(position, endPos));
+        }
+
+        uint32 expandedNodes = 0;
+        while (!open.empty() && expandedNodes < MAX_ROUTE_NODES)
+        {
+            OpenNode node = open.top();
+            open.pop();
+
+            if (node.Id == GOAL_NODE)
+            {
+                route.clear();
+                for (uint64 id = nodes[GOAL_NODE].Previous; id != NO_NODE; id = nodes[id].Previous)
+                {
+                    float const* position = getPortal(id).Position;
+                    route.push_back({ position[0], position[1], position[2] });
+                }
+
+                std::reverse(route.begin(), route.end());
+                return true;
+            }
+
+            Portal const& portal = getPortal(node.Id);
+            float cost = nodes[node.Id].Cost;
+
+            // a cheaper way to this portal was queued after this entry
+            if (node.EstimatedTotal > cost + dtVdist(portal.Position, endPos) + 0.01f)
+                continue;
+
+            ++expandedNodes;
+
+            if (portal.NeighbourTile == endTile)
+            {
+                push(GOAL_NODE, cost + dtVdist(portal.Position, endPos), node.Id, 0.0f);
+                continue;
+            }
+
+            auto neighbourItr = _portals.find(portal.NeighbourTile);
+            if (neighbourItr == _portals.end())
+                continue;
+
+            for (uint32 i = 0; i < neighbourItr->second.size(); ++i)
+            {
+                float const* position = neighbourItr->second[i].Position;
+                push(uint64(portal.NeighbourTile) << 32 | i, cost + dtVdist(portal.Position, position), node.Id, dtVdist(position, endPos));
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MMAP_TILE_GRAPH_H
+#define _MMAP_TILE_GRAPH_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MMAP
+{
+    typedef std::vector<std::array<float, 3>> TileRoute;
+
+    // coarse abstraction layer of a navmesh: the places where walkable polygons of two loaded tiles connect
+    // long paths are routed over these portals first and refined between them with dtNavMeshQuery,
+    // instead of depending on a single findPath search reaching the destination
+    // tiles are loaded by the map owning the grid while every instance of the map may be routing over the same graph,
+    // so AddTile/RemoveTile take the lock exclusively and FindRoute copies the portals it needs while holding it shared
+    class TC_COMMON_API TileGraph
+    {
+        public:
+            struct Portal
+            {
+                uint32 NeighbourTile;   // packed dtMeshHeader x/y of the tile this portal leads into
+                float Position[3];      // middle of the connecting polygon edge, in detour coordinates
+            };
+
+            // detour links tiles to their neighbours both ways, so those have to be rebuilt as well
+            void AddTile(dtNavMesh const* navMesh, dtTileRef tileRef);
+            void RemoveTile(dtNavMesh const* navMesh, int32 tileX, int32 tileY);
+
+            // fills route with the portals leading from startPos to endPos, both in detour coordinates
+            // returns false when both are in the same tile or the loaded tiles don't connect them
+            bool FindRoute(dtNavMesh const* navMesh, float const* startPos, float const* endPos, TileRoute& route) const;
+
+        private:
+            void BuildPortals(dtNavMesh const* navMesh, int32 tileX, int32 tileY);
+
+            static uint32 PackTile(int32 tileX, int32 tileY) { return uint32(tileX << 16 | (tileY & 0xFFFF)); }
+
+            std::unordered_map<uint32, std::vector<Portal>> _portals;
+            mutable std::shared_mutex _lock;
+    };
+}
+
+#endif
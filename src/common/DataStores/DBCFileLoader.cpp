@@ -21,6 +21,10 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#define DBC_HEADER_SIZE 20
 
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
 
@@ -29,8 +33,10 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
     uint32 header;
     if (data)
     {
-        delete [] data;
+        if (!_mappedFile)
+            delete [] data;
         data = nullptr;
+        _mappedFile.reset();
     }
 
     FILE* f = fopen(filename, "rb");
@@ -94,10 +100,25 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    std::size_t dataSize = std::size_t(recordSize) * recordCount + stringSize;
+
+    // never map past the end of a truncated file, touching those pages would crash instead of failing the load
+    if (fseek(f, 0, SEEK_END) != 0 || std::size_t(ftell(f)) < DBC_HEADER_SIZE + dataSize || fseek(f, DBC_HEADER_SIZE, SEEK_SET) != 0)
+    {
+        fclose(f);
+        return false;
+    }
+
+    if (MapFile(filename, dataSize))
+    {
+        fclose(f);
+        return true;
+    }
+
+    data = new unsigned char[dataSize];
     stringTable = data + recordSize*recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
+    if (fread(data, dataSize, 1, f) != 1)
     {
         fclose(f);
         return false;
@@ -108,9 +129,46 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
     return true;
 }
 
+bool DBCFileLoader::MapFile(char const* filename, std::size_t dataSize)
+{
+    if (!dataSize)
+        return false;
+
+    try
+    {
+        boost::interprocess::file_mapping file(filename, boost::interprocess::read_only);
+        // copy_on_write: pages stay shared with every other process mapping the same file until someone writes to them
+        _mappedFile = std::make_shared<boost::interprocess::mapped_region>(file, boost::interprocess::copy_on_write, DBC_HEADER_SIZE, dataSize);
+    }
+    catch (boost::interprocess::interprocess_exception const&)
+    {
+        _mappedFile.reset();
+        return false;
+    }
+
+    data = static_cast<unsigned char*>(_mappedFile->get_address());
+    stringTable = data + recordSize * recordCount;
+    return true;
+}
+
+bool DBCFileLoader::IsDirectlyMappable(char const* format) const
+{
+#if TRINITY_ENDIAN == TRINITY_BIGENDIAN
+    (void)format;
+    return false;
+#else
+    for (uint32 x = 0; format[x]; ++x)
+        if (format[x] != FT_IND && format[x] != FT_INT && format[x] != FT_FLOAT)
+            return false;
+
+    return recordSize == fieldCount * sizeof(uint32);
+#endif
+}
+
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    if (!_mappedFile)
+        delete[] data;
 
     delete[] fieldsOffset;
 }
@@ -209,6 +267,21 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
         indexTable = new ptr[recordCount];
     }
 
+    // records already have the layout of the struct, use them in place
+    if (_mappedFile && IsDirectlyMappable(format))
+    {
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            char* record = reinterpret_cast<char*>(data + y * recordSize);
+            if (i >= 0)
+                indexTable[getRecord(y).getUInt(i)] = record;
+            else
+                indexTable[y] = record;
+        }
+
+        return nullptr;
+    }
+
     char* dataTable = new char[recordCount * recordsize];
 
     uint32 offset = 0;
@@ -260,11 +333,16 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
 
 char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
-    if (strlen(format) != fieldCount)
+    if (strlen(format) != fieldCount || !strchr(format, FT_STRING))
         return nullptr;
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    // mapped string block stays valid as long as the mapping is kept alive, no need to copy it
+    char* stringPool = reinterpret_cast<char*>(stringTable);
+    if (!_mappedFile)
+    {
+        stringPool = new char[stringSize];
+        memcpy(stringPool, stringTable, stringSize);
+    }
 
     uint32 offset = 0;
 
@@ -310,5 +388,5 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return _mappedFile ? nullptr : stringPool;
 }
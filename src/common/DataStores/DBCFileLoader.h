@@ -21,6 +21,15 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
+
+namespace boost
+{
+    namespace interprocess
+    {
+        class mapped_region;
+    }
+}
 
 enum DbcFieldFormat
 {
@@ -40,6 +49,8 @@ enum DbcFieldFormat
 class TC_COMMON_API DBCFileLoader
 {
     public:
+        typedef std::shared_ptr<boost::interprocess::mapped_region> MappedFile;
+
         DBCFileLoader();
         ~DBCFileLoader();
 
@@ -94,10 +105,18 @@ class TC_COMMON_API DBCFileLoader
         uint32 GetCols() const { return fieldCount; }
         uint32 GetOffset(size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
         bool IsLoaded() const { return data != nullptr; }
+        /// Returns nullptr instead of a data table when records are used straight from the mapped file
         char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
+        /// Returns nullptr instead of a string pool when strings point into the mapped file (or there are none)
         char* AutoProduceStrings(char const* fmt, char* dataTable);
         static uint32 GetFormatRecordSize(const char * format, int32 * index_pos = nullptr);
+
+        /// Mapping the produced records/strings may point into, must outlive them. Empty if the file was read instead.
+        MappedFile const& GetMappedFile() const { return _mappedFile; }
     private:
+        bool MapFile(char const* filename, std::size_t dataSize);
+        /// Whether records of this format have the same layout in memory as on disk
+        bool IsDirectlyMappable(char const* format) const;
 
         uint32 recordSize;
         uint32 recordCount;
@@ -106,6 +125,7 @@ class TC_COMMON_API DBCFileLoader
         uint32 *fieldsOffset;
         unsigned char *data;
         unsigned char *stringTable;
+        MappedFile _mappedFile;
 
         DBCFileLoader(DBCFileLoader const& right) = delete;
         DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AliasTable.h"
+#include "Errors.h"
+#include "Random.h"
+#include <numeric>
+
+Trinity::AliasTable::AliasTable(std::vector<double> const& weights)
+{
+    double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    ASSERT(total > 0.0, "AliasTable needs at least one outcome with positive weight");
+
+    std::size_t count = weights.size();
+    _probabilities.resize(count);
+    _aliases.resize(count);
+
+    // scale so that the average column holds exactly 1.0
+    std::vector<uint32> small, large;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        _probabilities[i] = weights[i] * count / total;
+        _aliases[i] = i;
+        (_probabilities[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    // fill every underfull column with the excess of an overfull one
+    while (!small.empty() && !large.empty())
+    {
+        uint32 less = small.back();
+        small.pop_back();
+        uint32 more = large.back();
+
+        _aliases[less] = more;
+        _probabilities[more] -= 1.0 - _probabilities[less];
+        if (_probabilities[more] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // whatever is left is only off by rounding errors
+    for (uint32 i : large)
+        _probabilities[i] = 1.0;
+    for (uint32 i : small)
+        _probabilities[i] = weights[i] > 0.0 ? 1.0 : 0.0;
+}
+
+uint32 Trinity::AliasTable::Roll() const
+{
+    uint32 column = urand(0, uint32(_probabilities.size()) - 1);
+    return rand_norm() < _probabilities[column] ? column : _aliases[column];
+}
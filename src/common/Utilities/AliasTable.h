@@ -0,0 +1,49 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_ALIASTABLE_H
+#define TRINITY_ALIASTABLE_H
+
+#include "Define.h"
+#include <vector>
+
+namespace Trinity
+{
+    /*
+     * Walker/Vose alias method: after an O(n) build, every roll of a fixed
+     * discrete distribution costs one uniform index and one uniform coin
+     * no matter how many outcomes there are.
+     */
+    class TC_COMMON_API AliasTable
+    {
+    public:
+        AliasTable() = default;
+        explicit AliasTable(std::vector<double> const& weights);
+
+        // Returns an index into the weights the table was built from, never one with weight 0
+        uint32 Roll() const;
+
+        std::size_t size() const { return _probabilities.size(); }
+        bool empty() const { return _probabilities.empty(); }
+
+    private:
+        std::vector<double> _probabilities;
+        std::vector<uint32> _aliases;
+    };
+}
+
+#endif // TRINITY_ALIASTABLE_H
@@ -99,6 +99,15 @@ public:
         }
     }
 
+    // Replaces the buffer with a copy of data, skipping the zero fill Resize() would do first
+    void Assign(void const* data, std::size_t size)
+    {
+        uint8 const* bytes = static_cast<uint8 const*>(data);
+        _storage.assign(bytes, bytes + size);
+        _rpos = 0;
+        _wpos = size;
+    }
+
     std::vector<uint8>&& Move()
     {
         _wpos = 0;
@@ -293,6 +293,7 @@ void AuthSession::ReadHandler()
         }
 
         packet.ReadCompleted(size);
+        OnPacketReceived();
         SetTimeout();
     }
 
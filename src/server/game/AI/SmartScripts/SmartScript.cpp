@@ -181,7 +181,7 @@ void SmartScript::OnReset()
     ResetBaseObject();
     for (SmartScriptHolder& event : mEvents)
     {
-        if (!(event.event.event_flags & SMART_EVENT_FLAG_DONT_RESET))
+        if (!(event.GetEvent().event_flags & SMART_EVENT_FLAG_DONT_RESET))
         {
             InitTimer(event);
             event.runOnce = false;
@@ -238,15 +238,18 @@ void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint3
     }
     else
     {
-        for (SmartScriptHolder& event : mEvents)
+        if (e != SMART_EVENT_LINK)//special handling
         {
-            SMART_EVENT eventType = SMART_EVENT(event.GetEventType());
-            if (eventType == SMART_EVENT_LINK)//special handling
-                continue;
-
-            if (eventType == e)
+            for (uint32 pos : mEventTable.GetEvents(e))
+            {
+                SmartScriptHolder& event = mEvents[pos];
                 if (sConditionMgr->IsObjectMeetingSmartEventConditions(event.entryOrGuid, event.event_id, event.source_type, unit, GetBaseObject()))
+                {
                     ProcessEvent(event, unit, var0, var1, bvar, spell, gob);
+                    if (event.timer)
+                        ArmEvent(pos);
+                }
+            }
         }
     }
 
@@ -258,14 +261,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     e.runOnce = true; //used for repeat check
 
     // calc random
-    if (e.GetEventType() != SMART_EVENT_LINK && e.event.event_chance < 100 && e.event.event_chance && !(e.event.event_flags & SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL))
+    if (e.GetEventType() != SMART_EVENT_LINK && e.GetEvent().event_chance < 100 && e.GetEvent().event_chance && !e.ignoreChanceRoll)
     {
-        if (!roll_chance_i(e.event.event_chance))
+        if (!roll_chance_i(e.GetEvent().event_chance))
             return;
     }
 
-    // Remove SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL flag after processing roll chances as it's not needed anymore
-    e.event.event_flags &= ~SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL;
+    // Remove ignoreChanceRoll flag after processing roll chances as it's not needed anymore
+    e.ignoreChanceRoll = false;
 
     if (unit)
         mLastInvoker = unit->GetGUID();
@@ -280,14 +283,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     {
         case SMART_ACTION_TALK:
         {
-            Creature* talker = e.target.type == 0 ? me : nullptr;
+            Creature* talker = e.GetTarget().type == 0 ? me : nullptr;
             Unit* talkTarget = nullptr;
 
             for (WorldObject* target : targets)
             {
                 if (IsCreature(target) && !target->ToCreature()->IsPet()) // Prevented sending text to pets.
                 {
-                    if (e.action.talk.useTalkTarget)
+                    if (e.GetAction().talk.useTalkTarget)
                     {
                         talker = me;
                         talkTarget = target->ToCreature();
@@ -311,10 +314,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             mTalkerEntry = talker->GetEntry();
-            mLastTextID = e.action.talk.textGroupID;
-            mTextTimer = e.action.talk.duration;
+            mLastTextID = e.GetAction().talk.textGroupID;
+            mTextTimer = e.GetAction().talk.duration;
             mUseTextTimer = true;
-            sCreatureTextMgr->SendChat(talker, uint8(e.action.talk.textGroupID), talkTarget);
+            sCreatureTextMgr->SendChat(talker, uint8(e.GetAction().talk.textGroupID), talkTarget);
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_TALK: talker: {} {}, textGuid: {}",
                 talker->GetName(), talker->GetGUID().ToString(), talkTarget ? talkTarget->GetGUID().ToString() : "0");
             break;
@@ -324,14 +327,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 if (IsCreature(target))
-                    sCreatureTextMgr->SendChat(target->ToCreature(), uint8(e.action.simpleTalk.textGroupID), IsPlayer(GetLastInvoker()) ? GetLastInvoker() : 0);
+                    sCreatureTextMgr->SendChat(target->ToCreature(), uint8(e.GetAction().simpleTalk.textGroupID), IsPlayer(GetLastInvoker()) ? GetLastInvoker() : 0);
                 else if (IsPlayer(target) && me)
                 {
                     Unit* templastInvoker = GetLastInvoker();
-                    sCreatureTextMgr->SendChat(me, uint8(e.action.simpleTalk.textGroupID), IsPlayer(templastInvoker) ? templastInvoker : 0, CHAT_MSG_ADDON, LANG_ADDON, TEXT_RANGE_NORMAL, 0, TEAM_OTHER, false, target->ToPlayer());
+                    sCreatureTextMgr->SendChat(me, uint8(e.GetAction().simpleTalk.textGroupID), IsPlayer(templastInvoker) ? templastInvoker : 0, CHAT_MSG_ADDON, LANG_ADDON, TEXT_RANGE_NORMAL, 0, TEAM_OTHER, false, target->ToPlayer());
                 }
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SIMPLE_TALK: talker: {} {}, textGroupId: {}",
-                    target->GetName(), target->GetGUID().ToString(), uint8(e.action.simpleTalk.textGroupID));
+                    target->GetName(), target->GetGUID().ToString(), uint8(e.GetAction().simpleTalk.textGroupID));
             }
             break;
         }
@@ -341,9 +344,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    target->ToUnit()->HandleEmoteCommand(static_cast<Emote>(e.action.emote.emote));
+                    target->ToUnit()->HandleEmoteCommand(static_cast<Emote>(e.GetAction().emote.emote));
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_PLAY_EMOTE: target: {} {}, emote: {}",
-                        target->GetName(), target->GetGUID().ToString(), e.action.emote.emote);
+                        target->GetName(), target->GetGUID().ToString(), e.GetAction().emote.emote);
                 }
             }
             break;
@@ -354,13 +357,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.sound.distance == 1)
-                        target->PlayDistanceSound(e.action.sound.sound, e.action.sound.onlySelf ? target->ToPlayer() : nullptr);
+                    if (e.GetAction().sound.distance == 1)
+                        target->PlayDistanceSound(e.GetAction().sound.sound, e.GetAction().sound.onlySelf ? target->ToPlayer() : nullptr);
                     else
-                        target->PlayDirectSound(e.action.sound.sound, e.action.sound.onlySelf ? target->ToPlayer() : nullptr);
+                        target->PlayDirectSound(e.GetAction().sound.sound, e.GetAction().sound.onlySelf ? target->ToPlayer() : nullptr);
 
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SOUND: target: {} {}, sound: {}, onlyself: {}",
-                        target->GetName(), target->GetGUID().ToString(), e.action.sound.sound, e.action.sound.onlySelf);
+                        target->GetName(), target->GetGUID().ToString(), e.GetAction().sound.sound, e.GetAction().sound.onlySelf);
                 }
             }
             break;
@@ -371,11 +374,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsCreature(target))
                 {
-                    if (e.action.faction.factionID)
+                    if (e.GetAction().faction.factionID)
                     {
-                        target->ToCreature()->SetFaction(e.action.faction.factionID);
+                        target->ToCreature()->SetFaction(e.GetAction().faction.factionID);
                         TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_FACTION: Creature {} set faction to {}",
-                            target->GetGUID().ToString(), e.action.faction.factionID);
+                            target->GetGUID().ToString(), e.GetAction().faction.factionID);
                     }
                     else
                     {
@@ -400,12 +403,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsCreature(target))
                     continue;
 
-                if (e.action.morphOrMount.creature || e.action.morphOrMount.model)
+                if (e.GetAction().morphOrMount.creature || e.GetAction().morphOrMount.model)
                 {
                     //set model based on entry from creature_template
-                    if (e.action.morphOrMount.creature)
+                    if (e.GetAction().morphOrMount.creature)
                     {
-                        if (CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(e.action.morphOrMount.creature))
+                        if (CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(e.GetAction().morphOrMount.creature))
                         {
                             uint32 displayId = ObjectMgr::ChooseDisplayId(ci);
                             target->ToCreature()->SetDisplayId(displayId);
@@ -416,9 +419,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     //if no param1, then use value from param2 (modelId)
                     else
                     {
-                        target->ToCreature()->SetDisplayId(e.action.morphOrMount.model);
+                        target->ToCreature()->SetDisplayId(e.GetAction().morphOrMount.model);
                         TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_MORPH_TO_ENTRY_OR_MODEL: Creature {} set displayid to {}",
-                            target->GetGUID().ToString(), e.action.morphOrMount.model);
+                            target->GetGUID().ToString(), e.GetAction().morphOrMount.model);
                     }
                 }
                 else
@@ -436,9 +439,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsPlayer(target))
                 {
-                    target->ToPlayer()->FailQuest(e.action.quest.quest);
+                    target->ToPlayer()->FailQuest(e.GetAction().quest.quest);
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_FAIL_QUEST: Player {} fails quest {}",
-                        target->GetGUID().ToString(), e.action.quest.quest);
+                        target->GetGUID().ToString(), e.GetAction().quest.quest);
                 }
             }
             break;
@@ -449,9 +452,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (Player* player = target->ToPlayer())
                 {
-                    if (Quest const* q = sObjectMgr->GetQuestTemplate(e.action.questOffer.questID))
+                    if (Quest const* q = sObjectMgr->GetQuestTemplate(e.GetAction().questOffer.questID))
                     {
-                        if (me && e.action.questOffer.directAdd == 0)
+                        if (me && e.GetAction().questOffer.directAdd == 0)
                         {
                             if (player->CanTakeQuest(q, true))
                             {
@@ -459,7 +462,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                                 {
                                     PlayerMenu menu(session);
                                     menu.SendQuestGiverQuestDetails(q, me->GetGUID(), true);
-                                    TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_OFFER_QUEST: Player {} - offering quest {}", player->GetGUID().ToString(), e.action.questOffer.questID);
+                                    TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_OFFER_QUEST: Player {} - offering quest {}", player->GetGUID().ToString(), e.GetAction().questOffer.questID);
                                 }
                             }
                         }
@@ -467,7 +470,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         {
                             player->AddQuestAndCheckCompletion(q, nullptr);
                             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_OFFER_QUEST: Player {} - quest {} added",
-                                player->GetGUID().ToString(), e.action.questOffer.questID);
+                                player->GetGUID().ToString(), e.GetAction().questOffer.questID);
                         }
                     }
                 }
@@ -481,14 +484,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsCreature(target))
                     continue;
 
-                target->ToCreature()->SetReactState(ReactStates(e.action.react.state));
+                target->ToCreature()->SetReactState(ReactStates(e.GetAction().react.state));
             }
             break;
         }
         case SMART_ACTION_RANDOM_EMOTE:
         {
             std::vector<uint32> emotes;
-            std::copy_if(std::begin(e.action.randomEmote.emotes), std::end(e.action.randomEmote.emotes),
+            std::copy_if(std::begin(e.GetAction().randomEmote.emotes), std::end(e.GetAction().randomEmote.emotes),
                 std::back_inserter(emotes), [](uint32 emote) { return emote != 0; });
 
             for (WorldObject* target : targets)
@@ -510,9 +513,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             for (auto* ref : me->GetThreatManager().GetModifiableThreatList())
             {
-                ref->ModifyThreatByPercent(std::max<int32>(-100,int32(e.action.threatPCT.threatINC) - int32(e.action.threatPCT.threatDEC)));
+                ref->ModifyThreatByPercent(std::max<int32>(-100,int32(e.GetAction().threatPCT.threatINC) - int32(e.GetAction().threatPCT.threatDEC)));
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_THREAT_ALL_PCT: Creature {} modify threat for unit {}, value {}",
-                    me->GetGUID().ToString(), ref->GetVictim()->GetGUID().ToString(), int32(e.action.threatPCT.threatINC)-int32(e.action.threatPCT.threatDEC));
+                    me->GetGUID().ToString(), ref->GetVictim()->GetGUID().ToString(), int32(e.GetAction().threatPCT.threatINC)-int32(e.GetAction().threatPCT.threatDEC));
             }
             break;
         }
@@ -525,9 +528,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    me->GetThreatManager().ModifyThreatByPercent(target->ToUnit(), std::max<int32>(-100, int32(e.action.threatPCT.threatINC) - int32(e.action.threatPCT.threatDEC)));
+                    me->GetThreatManager().ModifyThreatByPercent(target->ToUnit(), std::max<int32>(-100, int32(e.GetAction().threatPCT.threatINC) - int32(e.GetAction().threatPCT.threatDEC)));
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_THREAT_SINGLE_PCT: Creature {} modify threat for unit {}, value {}",
-                        me->GetGUID().ToString(), target->GetGUID().ToString(), int32(e.action.threatPCT.threatINC) - int32(e.action.threatPCT.threatDEC));
+                        me->GetGUID().ToString(), target->GetGUID().ToString(), int32(e.GetAction().threatPCT.threatINC) - int32(e.GetAction().threatPCT.threatDEC));
                 }
             }
             break;
@@ -541,14 +544,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (Vehicle* vehicle = target->ToUnit()->GetVehicleKit())
                         for (std::pair<int8 const, VehicleSeat>& seat : vehicle->Seats)
                             if (Player* player = ObjectAccessor::GetPlayer(*target, seat.second.Passenger.Guid))
-                                player->AreaExploredOrEventHappens(e.action.quest.quest);
+                                player->AreaExploredOrEventHappens(e.GetAction().quest.quest);
 
                 if (IsPlayer(target))
                 {
-                    target->ToPlayer()->AreaExploredOrEventHappens(e.action.quest.quest);
+                    target->ToPlayer()->AreaExploredOrEventHappens(e.GetAction().quest.quest);
 
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_CALL_AREAEXPLOREDOREVENTHAPPENS: Player {} credited quest {}",
-                        target->GetGUID().ToString(), e.action.quest.quest);
+                        target->GetGUID().ToString(), e.GetAction().quest.quest);
                 }
             }
             break;
@@ -558,8 +561,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            if (e.action.cast.targetsLimit > 0 && targets.size() > e.action.cast.targetsLimit)
-                Trinity::Containers::RandomResize(targets, e.action.cast.targetsLimit);
+            if (e.GetAction().cast.targetsLimit > 0 && targets.size() > e.GetAction().cast.targetsLimit)
+                Trinity::Containers::RandomResize(targets, e.GetAction().cast.targetsLimit);
 
             bool failedSpellCast = false, successfulSpellCast = false;
 
@@ -567,31 +570,31 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 // may be nullptr
                 if (go)
-                    go->CastSpell(target->ToUnit(), e.action.cast.spell);
+                    go->CastSpell(target->ToUnit(), e.GetAction().cast.spell);
 
                 if (!IsUnit(target))
                     continue;
 
-                if (!(e.action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.action.cast.spell))
+                if (!(e.GetAction().cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.GetAction().cast.spell))
                 {
                     TriggerCastFlags triggerFlag = TRIGGERED_NONE;
-                    if (e.action.cast.castFlags & SMARTCAST_TRIGGERED)
+                    if (e.GetAction().cast.castFlags & SMARTCAST_TRIGGERED)
                     {
-                        if (e.action.cast.triggerFlags)
-                            triggerFlag = TriggerCastFlags(e.action.cast.triggerFlags);
+                        if (e.GetAction().cast.triggerFlags)
+                            triggerFlag = TriggerCastFlags(e.GetAction().cast.triggerFlags);
                         else
                             triggerFlag = TRIGGERED_FULL_MASK;
                     }
 
                     if (me)
                     {
-                        if (e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                        if (e.GetAction().cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                             me->InterruptNonMeleeSpells(false);
 
-                        SpellCastResult result = me->CastSpell(target->ToUnit(), e.action.cast.spell, triggerFlag);
+                        SpellCastResult result = me->CastSpell(target->ToUnit(), e.GetAction().cast.spell, triggerFlag);
                         bool spellCastFailed = (result != SPELL_CAST_OK && result != SPELL_FAILED_SPELL_IN_PROGRESS);
 
-                        if (e.action.cast.castFlags & SMARTCAST_COMBAT_MOVE)
+                        if (e.GetAction().cast.castFlags & SMARTCAST_COMBAT_MOVE)
                         {
                             // If cast flag SMARTCAST_COMBAT_MOVE is set combat movement will not be allowed unless target is outside spell range, out of mana, or LOS.
                             ENSURE_AI(SmartAI, me->AI())->SetCombatMove(spellCastFailed, true);
@@ -603,13 +606,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                             successfulSpellCast = true;
                     }
                     else if (go)
-                        go->CastSpell(target->ToUnit(), e.action.cast.spell, triggerFlag);
+                        go->CastSpell(target->ToUnit(), e.GetAction().cast.spell, triggerFlag);
 
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_CAST:: {} casts spell {} on target {} with castflags {}",
-                        me ? me->GetGUID().ToString() : go->GetGUID().ToString(), e.action.cast.spell, target->GetGUID().ToString(), e.action.cast.castFlags);
+                        me ? me->GetGUID().ToString() : go->GetGUID().ToString(), e.GetAction().cast.spell, target->GetGUID().ToString(), e.GetAction().cast.castFlags);
                 }
                 else
-                    TC_LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.action.cast.spell, target->GetGUID().ToString());
+                    TC_LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.GetAction().cast.spell, target->GetGUID().ToString());
             }
 
             // If there is at least 1 failed cast and no successful casts at all, retry again on next loop
@@ -626,14 +629,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            if (e.action.cast.targetsLimit)
-                Trinity::Containers::RandomResize(targets, e.action.cast.targetsLimit);
+            if (e.GetAction().cast.targetsLimit)
+                Trinity::Containers::RandomResize(targets, e.GetAction().cast.targetsLimit);
 
             TriggerCastFlags triggerFlags = TRIGGERED_NONE;
-            if (e.action.cast.castFlags & SMARTCAST_TRIGGERED)
+            if (e.GetAction().cast.castFlags & SMARTCAST_TRIGGERED)
             {
-                if (e.action.cast.triggerFlags)
-                    triggerFlags = TriggerCastFlags(e.action.cast.triggerFlags);
+                if (e.GetAction().cast.triggerFlags)
+                    triggerFlags = TriggerCastFlags(e.GetAction().cast.triggerFlags);
                 else
                     triggerFlags = TRIGGERED_FULL_MASK;
             }
@@ -644,12 +647,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!uTarget)
                     continue;
 
-                if (!(e.action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !uTarget->HasAura(e.action.cast.spell))
+                if (!(e.GetAction().cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !uTarget->HasAura(e.GetAction().cast.spell))
                 {
-                    if (e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                    if (e.GetAction().cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                         uTarget->InterruptNonMeleeSpells(false);
 
-                    uTarget->CastSpell(uTarget, e.action.cast.spell, triggerFlags);
+                    uTarget->CastSpell(uTarget, e.GetAction().cast.spell, triggerFlags);
                 }
             }
             break;
@@ -663,34 +666,34 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            if (e.action.cast.targetsLimit)
-                Trinity::Containers::RandomResize(targets, e.action.cast.targetsLimit);
+            if (e.GetAction().cast.targetsLimit)
+                Trinity::Containers::RandomResize(targets, e.GetAction().cast.targetsLimit);
 
             for (WorldObject* target : targets)
             {
                 if (!IsUnit(target))
                     continue;
 
-                if (!(e.action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.action.cast.spell))
+                if (!(e.GetAction().cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.GetAction().cast.spell))
                 {
-                    if (e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                    if (e.GetAction().cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                         tempLastInvoker->InterruptNonMeleeSpells(false);
 
                     TriggerCastFlags triggerFlag = TRIGGERED_NONE;
-                    if (e.action.cast.castFlags & SMARTCAST_TRIGGERED)
+                    if (e.GetAction().cast.castFlags & SMARTCAST_TRIGGERED)
                     {
-                        if (e.action.cast.triggerFlags)
-                            triggerFlag = TriggerCastFlags(e.action.cast.triggerFlags);
+                        if (e.GetAction().cast.triggerFlags)
+                            triggerFlag = TriggerCastFlags(e.GetAction().cast.triggerFlags);
                         else
                             triggerFlag = TRIGGERED_FULL_MASK;
                     }
 
-                    tempLastInvoker->CastSpell(target->ToUnit(), e.action.cast.spell, triggerFlag);
+                    tempLastInvoker->CastSpell(target->ToUnit(), e.GetAction().cast.spell, triggerFlag);
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_INVOKER_CAST: Invoker {} casts spell {} on target {} with castflags {}",
-                        tempLastInvoker->GetGUID().ToString(), e.action.cast.spell, target->GetGUID().ToString(), e.action.cast.castFlags);
+                        tempLastInvoker->GetGUID().ToString(), e.GetAction().cast.spell, target->GetGUID().ToString(), e.GetAction().cast.castFlags);
                 }
                 else
-                    TC_LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.action.cast.spell, target->GetGUID().ToString());
+                    TC_LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.GetAction().cast.spell, target->GetGUID().ToString());
             }
             break;
         }
@@ -728,9 +731,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    target->ToUnit()->SetEmoteState(Emote(e.action.emote.emote));
+                    target->ToUnit()->SetEmoteState(Emote(e.GetAction().emote.emote));
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_EMOTE_STATE. Unit {} set emotestate to {}",
-                        target->GetGUID().ToString(), e.action.emote.emote);
+                        target->GetGUID().ToString(), e.GetAction().emote.emote);
                 }
             }
             break;
@@ -740,9 +743,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            ENSURE_AI(SmartAI, me->AI())->SetAutoAttack(e.action.autoAttack.attack != 0);
+            ENSURE_AI(SmartAI, me->AI())->SetAutoAttack(e.GetAction().autoAttack.attack != 0);
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_AUTO_ATTACK: Creature: {} bool on = {}",
-                me->GetGUID().ToString(), e.action.autoAttack.attack);
+                me->GetGUID().ToString(), e.GetAction().autoAttack.attack);
             break;
         }
         case SMART_ACTION_ALLOW_COMBAT_MOVEMENT:
@@ -750,10 +753,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            bool move = e.action.combatMove.move != 0;
+            bool move = e.GetAction().combatMove.move != 0;
             ENSURE_AI(SmartAI, me->AI())->SetCombatMove(move);
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_ALLOW_COMBAT_MOVEMENT: Creature {} bool on = {}",
-                me->GetGUID().ToString(), e.action.combatMove.move);
+                me->GetGUID().ToString(), e.GetAction().combatMove.move);
             break;
         }
         case SMART_ACTION_SET_EVENT_PHASE:
@@ -761,9 +764,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!GetBaseObject())
                 break;
 
-            SetPhase(e.action.setEventPhase.phase);
+            SetPhase(e.GetAction().setEventPhase.phase);
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_EVENT_PHASE: Creature {} set event phase {}",
-                GetBaseObject()->GetGUID().ToString(), e.action.setEventPhase.phase);
+                GetBaseObject()->GetGUID().ToString(), e.GetAction().setEventPhase.phase);
             break;
         }
         case SMART_ACTION_INC_EVENT_PHASE:
@@ -771,10 +774,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!GetBaseObject())
                 break;
 
-            IncPhase(e.action.incEventPhase.inc);
-            DecPhase(e.action.incEventPhase.dec);
+            IncPhase(e.GetAction().incEventPhase.inc);
+            DecPhase(e.GetAction().incEventPhase.dec);
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_INC_EVENT_PHASE: Creature {} inc event phase by {}, "
-                "decrease by {}", GetBaseObject()->GetGUID().ToString(), e.action.incEventPhase.inc, e.action.incEventPhase.dec);
+                "decrease by {}", GetBaseObject()->GetGUID().ToString(), e.GetAction().incEventPhase.inc, e.GetAction().incEventPhase.dec);
             break;
         }
         case SMART_ACTION_EVADE:
@@ -783,7 +786,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             // Reset home position to respawn position if specified in the parameters
-            if (e.action.evade.toRespawnPosition == 0)
+            if (e.GetAction().evade.toRespawnPosition == 0)
             {
                 float homeX, homeY, homeZ, homeO;
                 me->GetRespawnPosition(homeX, homeY, homeZ, &homeO);
@@ -801,7 +804,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             me->DoFleeToGetAssistance();
 
-            if (e.action.fleeAssist.withEmote)
+            if (e.GetAction().fleeAssist.withEmote)
             {
                 Trinity::BroadcastTextBuilder builder(me, CHAT_MSG_MONSTER_EMOTE, BROADCAST_TEXT_FLEE_FOR_ASSIST, me->GetGender());
                 sCreatureTextMgr->SendChatPacket(me, builder, CHAT_MSG_MONSTER_EMOTE);
@@ -818,16 +821,16 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             Player* playerCharmed = unit->GetCharmerOrOwnerPlayerOrPlayerItself();
             if (playerCharmed && GetBaseObject())
             {
-                playerCharmed->GroupEventHappens(e.action.quest.quest, GetBaseObject());
+                playerCharmed->GroupEventHappens(e.GetAction().quest.quest, GetBaseObject());
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_CALL_GROUPEVENTHAPPENS: Player {}, group credit for quest {}",
-                    unit->GetGUID().ToString(), e.action.quest.quest);
+                    unit->GetGUID().ToString(), e.GetAction().quest.quest);
             }
 
             // Special handling for vehicles
             if (Vehicle* vehicle = unit->GetVehicleKit())
                 for (std::pair<int8 const, VehicleSeat>& seat : vehicle->Seats)
                     if (Player* passenger = ObjectAccessor::GetPlayer(*unit, seat.second.Passenger.Guid))
-                        passenger->GroupEventHappens(e.action.quest.quest, GetBaseObject());
+                        passenger->GroupEventHappens(e.GetAction().quest.quest, GetBaseObject());
             break;
         }
         case SMART_ACTION_COMBAT_STOP:
@@ -846,29 +849,29 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsUnit(target))
                     continue;
 
-                if (e.action.removeAura.spell)
+                if (e.GetAction().removeAura.spell)
                 {
                     ObjectGuid casterGUID;
-                    if (e.action.removeAura.onlyOwnedAuras)
+                    if (e.GetAction().removeAura.onlyOwnedAuras)
                     {
                         if (!me)
                             break;
                         casterGUID = me->GetGUID();
                     }
 
-                    if (e.action.removeAura.charges)
+                    if (e.GetAction().removeAura.charges)
                     {
-                        if (Aura* aur = target->ToUnit()->GetAura(e.action.removeAura.spell, casterGUID))
-                            aur->ModCharges(-static_cast<int32>(e.action.removeAura.charges), AURA_REMOVE_BY_EXPIRE);
+                        if (Aura* aur = target->ToUnit()->GetAura(e.GetAction().removeAura.spell, casterGUID))
+                            aur->ModCharges(-static_cast<int32>(e.GetAction().removeAura.charges), AURA_REMOVE_BY_EXPIRE);
                     }
                     else
-                        target->ToUnit()->RemoveAurasDueToSpell(e.action.removeAura.spell, casterGUID);
+                        target->ToUnit()->RemoveAurasDueToSpell(e.GetAction().removeAura.spell, casterGUID);
                 }
                 else
                     target->ToUnit()->RemoveAllAuras();
 
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_REMOVEAURASFROMSPELL: Unit {}, spell {}",
-                    target->GetGUID().ToString(), e.action.removeAura.spell);
+                    target->GetGUID().ToString(), e.GetAction().removeAura.spell);
             }
             break;
         }
@@ -887,8 +890,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    float angle = e.action.follow.angle > 6 ? (e.action.follow.angle * M_PI / 180.0f) : e.action.follow.angle;
-                    ENSURE_AI(SmartAI, me->AI())->SetFollow(target->ToUnit(), float(e.action.follow.dist) + 0.1f, angle, e.action.follow.credit, e.action.follow.entry, e.action.follow.creditType);
+                    float angle = e.GetAction().follow.angle > 6 ? (e.GetAction().follow.angle * M_PI / 180.0f) : e.GetAction().follow.angle;
+                    ENSURE_AI(SmartAI, me->AI())->SetFollow(target->ToUnit(), float(e.GetAction().follow.dist) + 0.1f, angle, e.GetAction().follow.credit, e.GetAction().follow.entry, e.GetAction().follow.creditType);
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_FOLLOW: Creature {} following target {}",
                         me->GetGUID().ToString(), target->GetGUID().ToString());
                     break;
@@ -902,7 +905,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             std::vector<uint32> phases;
-            std::copy_if(std::begin(e.action.randomPhase.phases), std::end(e.action.randomPhase.phases),
+            std::copy_if(std::begin(e.GetAction().randomPhase.phases), std::end(e.GetAction().randomPhase.phases),
                 std::back_inserter(phases), [](uint32 phase) { return phase != 0; });
 
             uint32 phase = Trinity::Containers::SelectRandomContainerElement(phases);
@@ -916,7 +919,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!GetBaseObject())
                 break;
 
-            uint32 phase = urand(e.action.randomPhaseRange.phaseMin, e.action.randomPhaseRange.phaseMax);
+            uint32 phase = urand(e.GetAction().randomPhaseRange.phaseMin, e.GetAction().randomPhaseRange.phaseMax);
             SetPhase(phase);
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_RANDOM_PHASE_RANGE: Creature {} sets event phase to {}",
                 GetBaseObject()->GetGUID().ToString(), phase);
@@ -924,16 +927,16 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_CALL_KILLEDMONSTER:
         {
-            if (e.target.type == SMART_TARGET_NONE || e.target.type == SMART_TARGET_SELF) // Loot recipient and his group members
+            if (e.GetTarget().type == SMART_TARGET_NONE || e.GetTarget().type == SMART_TARGET_SELF) // Loot recipient and his group members
             {
                 if (!me)
                     break;
 
                 if (Player* player = me->GetLootRecipient())
                 {
-                    player->RewardPlayerAndGroupAtEvent(e.action.killedMonster.creature, player);
+                    player->RewardPlayerAndGroupAtEvent(e.GetAction().killedMonster.creature, player);
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_CALL_KILLEDMONSTER: Player {}, Killcredit: {}",
-                        player->GetGUID().ToString(), e.action.killedMonster.creature);
+                        player->GetGUID().ToString(), e.GetAction().killedMonster.creature);
                 }
             }
             else // Specific target type
@@ -942,15 +945,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     if (IsPlayer(target))
                     {
-                        target->ToPlayer()->KilledMonsterCredit(e.action.killedMonster.creature);
+                        target->ToPlayer()->KilledMonsterCredit(e.GetAction().killedMonster.creature);
                         TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_CALL_KILLEDMONSTER: Player {}, Killcredit: {}",
-                            target->GetGUID().ToString(), e.action.killedMonster.creature);
+                            target->GetGUID().ToString(), e.GetAction().killedMonster.creature);
                     }
                     else if (IsUnit(target)) // Special handling for vehicles
                         if (Vehicle* vehicle = target->ToUnit()->GetVehicleKit())
                             for (std::pair<int8 const, VehicleSeat>& seat : vehicle->Seats)
                                 if (Player* player = ObjectAccessor::GetPlayer(*target, seat.second.Passenger.Guid))
-                                    player->KilledMonsterCredit(e.action.killedMonster.creature);
+                                    player->KilledMonsterCredit(e.GetAction().killedMonster.creature);
                 }
             }
             break;
@@ -971,17 +974,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
             }
 
-            switch (e.action.setInstanceData.type)
+            switch (e.GetAction().setInstanceData.type)
             {
                 case 0:
-                    instance->SetData(e.action.setInstanceData.field, e.action.setInstanceData.data);
+                    instance->SetData(e.GetAction().setInstanceData.field, e.GetAction().setInstanceData.data);
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA: SetData Field: {}, data: {}",
-                        e.action.setInstanceData.field, e.action.setInstanceData.data);
+                        e.GetAction().setInstanceData.field, e.GetAction().setInstanceData.data);
                     break;
                 case 1:
-                    instance->SetBossState(e.action.setInstanceData.field, static_cast<EncounterState>(e.action.setInstanceData.data));
+                    instance->SetBossState(e.GetAction().setInstanceData.field, static_cast<EncounterState>(e.GetAction().setInstanceData.data));
                     TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA: SetBossState BossId: {}, State: {} ({})",
-                        e.action.setInstanceData.field, e.action.setInstanceData.data, InstanceScript::GetBossStateName(e.action.setInstanceData.data));
+                        e.GetAction().setInstanceData.field, e.GetAction().setInstanceData.data, InstanceScript::GetBossStateName(e.GetAction().setInstanceData.data));
                     break;
                 default: // Static analysis
                     break;
@@ -1007,16 +1010,16 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            instance->SetGuidData(e.action.setInstanceData64.field, targets.front()->GetGUID());
+            instance->SetGuidData(e.GetAction().setInstanceData64.field, targets.front()->GetGUID());
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA64: Field: {}, data: {}",
-                e.action.setInstanceData64.field, targets.front()->GetGUID().ToString());
+                e.GetAction().setInstanceData64.field, targets.front()->GetGUID().ToString());
             break;
         }
         case SMART_ACTION_UPDATE_TEMPLATE:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->UpdateEntry(e.action.updateTemplate.creature, nullptr, e.action.updateTemplate.updateLevel != 0);
+                    target->ToCreature()->UpdateEntry(e.GetAction().updateTemplate.creature, nullptr, e.GetAction().updateTemplate.updateLevel != 0);
             break;
         }
         case SMART_ACTION_DIE:
@@ -1041,8 +1044,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (me)
             {
-                me->CallForHelp(float(e.action.callHelp.range));
-                if (e.action.callHelp.withEmote)
+                me->CallForHelp(float(e.GetAction().callHelp.range));
+                if (e.GetAction().callHelp.withEmote)
                 {
                     Trinity::BroadcastTextBuilder builder(me, CHAT_MSG_MONSTER_EMOTE, BROADCAST_TEXT_CALL_FOR_HELP, me->GetGender());
                     sCreatureTextMgr->SendChatPacket(me, builder, CHAT_MSG_MONSTER_EMOTE);
@@ -1055,20 +1058,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (me)
             {
-                me->SetSheath(SheathState(e.action.setSheath.sheath));
+                me->SetSheath(SheathState(e.GetAction().setSheath.sheath));
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_SET_SHEATH: Creature {}, State: {}",
-                    me->GetGUID().ToString(), e.action.setSheath.sheath);
+                    me->GetGUID().ToString(), e.GetAction().setSheath.sheath);
             }
             break;
         }
         case SMART_ACTION_FORCE_DESPAWN:
         {
             // there should be at least a world update tick before despawn, to avoid breaking linked actions
-            Milliseconds despawnDelay(e.action.forceDespawn.delay);
+            Milliseconds despawnDelay(e.GetAction().forceDespawn.delay);
             if (despawnDelay <= 0ms)
                 despawnDelay = 1ms;
 
-            Seconds forceRespawnTimer(e.action.forceDespawn.forceRespawnTimer);
+            Seconds forceRespawnTimer(e.GetAction().forceDespawn.forceRespawnTimer);
 
             for (WorldObject* target : targets)
             {
@@ -1084,9 +1087,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 if (IsUnit(target))
-                    target->ToUnit()->SetPhaseMask(e.action.ingamePhaseMask.mask, true);
+                    target->ToUnit()->SetPhaseMask(e.GetAction().ingamePhaseMask.mask, true);
                 else if (IsGameObject(target))
-                    target->ToGameObject()->SetPhaseMask(e.action.ingamePhaseMask.mask, true);
+                    target->ToGameObject()->SetPhaseMask(e.GetAction().ingamePhaseMask.mask, true);
             }
             break;
         }
@@ -1097,15 +1100,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsUnit(target))
                     continue;
 
-                if (e.action.morphOrMount.creature || e.action.morphOrMount.model)
+                if (e.GetAction().morphOrMount.creature || e.GetAction().morphOrMount.model)
                 {
-                    if (e.action.morphOrMount.creature > 0)
+                    if (e.GetAction().morphOrMount.creature > 0)
                     {
-                        if (CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(e.action.morphOrMount.creature))
+                        if (CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(e.GetAction().morphOrMount.creature))
                             target->ToUnit()->Mount(ObjectMgr::ChooseDisplayId(cInfo));
                     }
                     else
-                        target->ToUnit()->Mount(e.action.morphOrMount.model);
+                        target->ToUnit()->Mount(e.GetAction().morphOrMount.model);
                 }
                 else
                     target->ToUnit()->Dismount();
@@ -1122,10 +1125,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (!ai)
                         continue;
 
-                    if (e.action.invincHP.percent)
-                        ai->SetInvincibilityHpLevel(target->ToCreature()->CountPctFromMaxHealth(e.action.invincHP.percent));
+                    if (e.GetAction().invincHP.percent)
+                        ai->SetInvincibilityHpLevel(target->ToCreature()->CountPctFromMaxHealth(e.GetAction().invincHP.percent));
                     else
-                        ai->SetInvincibilityHpLevel(e.action.invincHP.minHP);
+                        ai->SetInvincibilityHpLevel(e.GetAction().invincHP.minHP);
                 }
             }
             break;
@@ -1138,17 +1141,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     CreatureAI* ai = cTarget->AI();
                     if (IsSmart(cTarget, true))
-                        ENSURE_AI(SmartAI, ai)->SetData(e.action.setData.field, e.action.setData.data, me);
+                        ENSURE_AI(SmartAI, ai)->SetData(e.GetAction().setData.field, e.GetAction().setData.data, me);
                     else
-                        ai->SetData(e.action.setData.field, e.action.setData.data);
+                        ai->SetData(e.GetAction().setData.field, e.GetAction().setData.data);
                 }
                 else if (GameObject* oTarget = target->ToGameObject())
                 {
                     GameObjectAI* ai = oTarget->AI();
                     if (IsSmart(oTarget, true))
-                        ENSURE_AI(SmartGameObjectAI, ai)->SetData(e.action.setData.field, e.action.setData.data, me);
+                        ENSURE_AI(SmartGameObjectAI, ai)->SetData(e.GetAction().setData.field, e.GetAction().setData.data, me);
                     else
-                        ai->SetData(e.action.setData.field, e.action.setData.data);
+                        ai->SetData(e.GetAction().setData.field, e.GetAction().setData.data);
                 }
             }
             break;
@@ -1167,7 +1170,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsCreature(target))
                     continue;
 
-                if (!(e.event.event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(target))
+                if (!(e.GetEvent().event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(target))
                     continue;
 
                 Position pos = target->GetPosition();
@@ -1175,9 +1178,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 // Use forward/backward/left/right cartesian plane movement
                 float x, y, z, o;
                 o = pos.GetOrientation();
-                x = pos.GetPositionX() + (std::cos(o - (M_PI / 2))*e.target.x) + (std::cos(o)*e.target.y);
-                y = pos.GetPositionY() + (std::sin(o - (M_PI / 2))*e.target.x) + (std::sin(o)*e.target.y);
-                z = pos.GetPositionZ() + e.target.z;
+                x = pos.GetPositionX() + (std::cos(o - (M_PI / 2))*e.GetTarget().x) + (std::cos(o)*e.GetTarget().y);
+                y = pos.GetPositionY() + (std::sin(o - (M_PI / 2))*e.GetTarget().x) + (std::sin(o)*e.GetTarget().y);
+                z = pos.GetPositionZ() + e.GetTarget().z;
                 target->ToCreature()->GetMotionMaster()->MovePoint(SMART_RANDOM_POINT, x, y, z);
             }
             break;
@@ -1186,13 +1189,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetVisible(e.action.visibility.state ? true : false);
+                    target->ToUnit()->SetVisible(e.GetAction().visibility.state ? true : false);
             break;
         }
         case SMART_ACTION_SET_ACTIVE:
         {
             for (WorldObject* target : targets)
-                target->setActive(e.action.active.state ? true : false);
+                target->setActive(e.GetAction().active.state ? true : false);
             break;
         }
         case SMART_ACTION_ATTACK_START:
@@ -1210,7 +1213,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_SUMMON_CREATURE:
         {
-            EnumFlag<SmartActionSummonCreatureFlags> flags(static_cast<SmartActionSummonCreatureFlags>(e.action.summonCreature.flags));
+            EnumFlag<SmartActionSummonCreatureFlags> flags(static_cast<SmartActionSummonCreatureFlags>(e.GetAction().summonCreature.flags));
             bool preferUnit = flags.HasFlag(SmartActionSummonCreatureFlags::PreferUnit);
             WorldObject* summoner = preferUnit ? unit : Coalesce<WorldObject>(GetBaseObjectOrPlayerTrigger(), unit);
             if (!summoner)
@@ -1219,20 +1222,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             ObjectGuid privateObjectOwner;
             if (flags.HasFlag(SmartActionSummonCreatureFlags::PersonalSpawn))
                 privateObjectOwner = summoner->IsPrivateObject() ? summoner->GetPrivateObjectOwner() : summoner->GetGUID();
-            uint32 spawnsCount = std::max(e.action.summonCreature.count, 1u);
+            uint32 spawnsCount = std::max(e.GetAction().summonCreature.count, 1u);
 
             float x, y, z, o;
             for (WorldObject* target : targets)
             {
                 target->GetPosition(x, y, z, o);
-                x += e.target.x;
-                y += e.target.y;
-                z += e.target.z;
-                o += e.target.o;
+                x += e.GetTarget().x;
+                y += e.GetTarget().y;
+                z += e.GetTarget().z;
+                o += e.GetTarget().o;
                 for (uint32 counter = 0; counter < spawnsCount; counter++)
                 {
-                    if (Creature* summon = summoner->SummonCreature(e.action.summonCreature.creature, x, y, z, o, (TempSummonType)e.action.summonCreature.type, Milliseconds(e.action.summonCreature.duration), privateObjectOwner))
-                        if (e.action.summonCreature.attackInvoker)
+                    if (Creature* summon = summoner->SummonCreature(e.GetAction().summonCreature.creature, x, y, z, o, (TempSummonType)e.GetAction().summonCreature.type, Milliseconds(e.GetAction().summonCreature.duration), privateObjectOwner))
+                        if (e.GetAction().summonCreature.attackInvoker)
                             summon->AI()->AttackStart(target->ToUnit());
                 }
             }
@@ -1242,8 +1245,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             for (uint32 counter = 0; counter < spawnsCount; counter++)
             {
-                if (Creature* summon = summoner->SummonCreature(e.action.summonCreature.creature, e.target.x, e.target.y, e.target.z, e.target.o, (TempSummonType)e.action.summonCreature.type, Milliseconds(e.action.summonCreature.duration), privateObjectOwner))
-                    if (unit && e.action.summonCreature.attackInvoker)
+                if (Creature* summon = summoner->SummonCreature(e.GetAction().summonCreature.creature, e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, e.GetTarget().o, (TempSummonType)e.GetAction().summonCreature.type, Milliseconds(e.GetAction().summonCreature.duration), privateObjectOwner))
+                    if (unit && e.GetAction().summonCreature.attackInvoker)
                         summon->AI()->AttackStart(unit);
             }
             break;
@@ -1255,16 +1258,16 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             for (WorldObject* target : targets)
             {
-                Position pos = target->GetPositionWithOffset(Position(e.target.x, e.target.y, e.target.z, e.target.o));
+                Position pos = target->GetPositionWithOffset(Position(e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, e.GetTarget().o));
                 QuaternionData rot = QuaternionData::fromEulerAnglesZYX(pos.GetOrientation(), 0.f, 0.f);
-                GetBaseObject()->SummonGameObject(e.action.summonGO.entry, pos, rot, Seconds(e.action.summonGO.despawnTime), GOSummonType(e.action.summonGO.summonType));
+                GetBaseObject()->SummonGameObject(e.GetAction().summonGO.entry, pos, rot, Seconds(e.GetAction().summonGO.despawnTime), GOSummonType(e.GetAction().summonGO.summonType));
             }
 
             if (e.GetTargetType() != SMART_TARGET_POSITION)
                 break;
 
-            QuaternionData rot = QuaternionData::fromEulerAnglesZYX(e.target.o, 0.f, 0.f);
-            GetBaseObject()->SummonGameObject(e.action.summonGO.entry, Position(e.target.x, e.target.y, e.target.z, e.target.o), rot, Seconds(e.action.summonGO.despawnTime), GOSummonType(e.action.summonGO.summonType));
+            QuaternionData rot = QuaternionData::fromEulerAnglesZYX(e.GetTarget().o, 0.f, 0.f);
+            GetBaseObject()->SummonGameObject(e.GetAction().summonGO.entry, Position(e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, e.GetTarget().o), rot, Seconds(e.GetAction().summonGO.despawnTime), GOSummonType(e.GetAction().summonGO.summonType));
             break;
         }
         case SMART_ACTION_KILL_UNIT:
@@ -1285,7 +1288,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->AddItem(e.action.item.entry, e.action.item.count);
+                target->ToPlayer()->AddItem(e.GetAction().item.entry, e.GetAction().item.count);
             }
             break;
         }
@@ -1296,13 +1299,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->DestroyItemCount(e.action.item.entry, e.action.item.count, true);
+                target->ToPlayer()->DestroyItemCount(e.GetAction().item.entry, e.GetAction().item.count, true);
             }
             break;
         }
         case SMART_ACTION_STORE_TARGET_LIST:
         {
-            StoreTargetList(targets, e.action.storeTargets.id);
+            StoreTargetList(targets, e.GetAction().storeTargets.id);
             break;
         }
         case SMART_ACTION_TELEPORT:
@@ -1310,9 +1313,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 if (IsPlayer(target))
-                    target->ToPlayer()->TeleportTo(e.action.teleport.mapID, e.target.x, e.target.y, e.target.z, e.target.o);
+                    target->ToPlayer()->TeleportTo(e.GetAction().teleport.mapID, e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, e.GetTarget().o);
                 else if (IsCreature(target))
-                    target->ToCreature()->NearTeleportTo(e.target.x, e.target.y, e.target.z, e.target.o);
+                    target->ToCreature()->NearTeleportTo(e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, e.GetTarget().o);
             }
             break;
         }
@@ -1321,7 +1324,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            ENSURE_AI(SmartAI, me->AI())->SetDisableGravity(e.action.setDisableGravity.disable != 0);
+            ENSURE_AI(SmartAI, me->AI())->SetDisableGravity(e.GetAction().setDisableGravity.disable != 0);
             break;
         }
         case SMART_ACTION_SET_RUN:
@@ -1329,7 +1332,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            ENSURE_AI(SmartAI, me->AI())->SetRun(e.action.setRun.run != 0);
+            ENSURE_AI(SmartAI, me->AI())->SetRun(e.GetAction().setRun.run != 0);
             break;
         }
         case SMART_ACTION_SET_COUNTER:
@@ -1341,21 +1344,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (IsCreature(target))
                     {
                         if (SmartAI* ai = CAST_AI(SmartAI, target->ToCreature()->AI()))
-                            ai->GetScript()->StoreCounter(e.action.setCounter.counterId, e.action.setCounter.value, e.action.setCounter.reset);
+                            ai->GetScript()->StoreCounter(e.GetAction().setCounter.counterId, e.GetAction().setCounter.value, e.GetAction().setCounter.reset);
                         else
                             TC_LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SET_COUNTER is not using SmartAI, skipping");
                     }
                     else if (IsGameObject(target))
                     {
                         if (SmartGameObjectAI* ai = CAST_AI(SmartGameObjectAI, target->ToGameObject()->AI()))
-                            ai->GetScript()->StoreCounter(e.action.setCounter.counterId, e.action.setCounter.value, e.action.setCounter.reset);
+                            ai->GetScript()->StoreCounter(e.GetAction().setCounter.counterId, e.GetAction().setCounter.value, e.GetAction().setCounter.reset);
                         else
                             TC_LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SET_COUNTER is not using SmartGameObjectAI, skipping");
                     }
                 }
             }
             else
-                StoreCounter(e.action.setCounter.counterId, e.action.setCounter.value, e.action.setCounter.reset);
+                StoreCounter(e.GetAction().setCounter.counterId, e.GetAction().setCounter.value, e.GetAction().setCounter.reset);
             break;
         }
         case SMART_ACTION_WP_START:
@@ -1363,9 +1366,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            bool run = e.action.wpStart.run != 0;
-            uint32 entry = e.action.wpStart.pathID;
-            bool repeat = e.action.wpStart.repeat != 0;
+            bool run = e.GetAction().wpStart.run != 0;
+            uint32 entry = e.GetAction().wpStart.pathID;
+            bool repeat = e.GetAction().wpStart.repeat != 0;
 
             for (WorldObject* target : targets)
             {
@@ -1378,8 +1381,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             ENSURE_AI(SmartAI, me->AI())->StartPath(run, entry, repeat, unit);
 
-            uint32 quest = e.action.wpStart.quest;
-            uint32 DespawnTime = e.action.wpStart.despawnTime;
+            uint32 quest = e.GetAction().wpStart.quest;
+            uint32 DespawnTime = e.GetAction().wpStart.despawnTime;
             ENSURE_AI(SmartAI, me->AI())->SetEscortQuest(quest);
             ENSURE_AI(SmartAI, me->AI())->SetDespawnTime(DespawnTime);
             break;
@@ -1389,7 +1392,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            uint32 delay = e.action.wpPause.delay;
+            uint32 delay = e.GetAction().wpPause.delay;
             ENSURE_AI(SmartAI, me->AI())->PausePath(delay, true);
             break;
         }
@@ -1398,9 +1401,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            uint32 DespawnTime = e.action.wpStop.despawnTime;
-            uint32 quest = e.action.wpStop.quest;
-            bool fail = e.action.wpStop.fail != 0;
+            uint32 DespawnTime = e.GetAction().wpStop.despawnTime;
+            uint32 quest = e.GetAction().wpStop.quest;
+            bool fail = e.GetAction().wpStop.fail != 0;
             ENSURE_AI(SmartAI, me->AI())->StopPath(DespawnTime, quest, fail);
             break;
         }
@@ -1422,7 +1425,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (e.GetTargetType() == SMART_TARGET_SELF)
                 me->SetFacingTo((me->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT) && me->GetTransGUID() ? me->GetTransportHomePosition() : me->GetHomePosition()).GetOrientation());
             else if (e.GetTargetType() == SMART_TARGET_POSITION)
-                me->SetFacingTo(e.target.o);
+                me->SetFacingTo(e.GetTarget().o);
             else if (!targets.empty())
                 me->SetFacingToObject(targets.front());
             break;
@@ -1434,7 +1437,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->SendMovieStart(e.action.movie.entry);
+                target->ToPlayer()->SendMovieStart(e.GetAction().movie.entry);
             }
             break;
         }
@@ -1453,20 +1456,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 float x, y, z;
                 target->GetPosition(x, y, z);
-                if (e.action.moveToPos.ContactDistance > 0)
-                    target->GetContactPoint(me, x, y, z, e.action.moveToPos.ContactDistance);
-                me->GetMotionMaster()->MovePoint(e.action.moveToPos.pointId, x + e.target.x, y + e.target.y, z + e.target.z, e.action.moveToPos.disablePathfinding == 0);
+                if (e.GetAction().moveToPos.ContactDistance > 0)
+                    target->GetContactPoint(me, x, y, z, e.GetAction().moveToPos.ContactDistance);
+                me->GetMotionMaster()->MovePoint(e.GetAction().moveToPos.pointId, x + e.GetTarget().x, y + e.GetTarget().y, z + e.GetTarget().z, e.GetAction().moveToPos.disablePathfinding == 0);
             }
 
             if (e.GetTargetType() != SMART_TARGET_POSITION)
                 break;
 
-            Position dest(e.target.x, e.target.y, e.target.z);
-            if (e.action.moveToPos.transport)
+            Position dest(e.GetTarget().x, e.GetTarget().y, e.GetTarget().z);
+            if (e.GetAction().moveToPos.transport)
                 if (TransportBase* trans = me->GetDirectTransport())
                     trans->CalculatePassengerPosition(dest.m_positionX, dest.m_positionY, dest.m_positionZ);
 
-            me->GetMotionMaster()->MovePoint(e.action.moveToPos.pointId, dest, e.action.moveToPos.disablePathfinding == 0);
+            me->GetMotionMaster()->MovePoint(e.GetAction().moveToPos.pointId, dest, e.GetAction().moveToPos.disablePathfinding == 0);
             break;
         }
         case SMART_ACTION_ENABLE_TEMP_GOBJ:
@@ -1480,7 +1483,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (target->ToGameObject()->isSpawnedByDefault())
                         TC_LOG_WARN("sql.sql", "Invalid gameobject target '{}' (entry {}, spawnId {}) for SMART_ACTION_ENABLE_TEMP_GOBJ - the object is spawned by default", target->GetName(), target->GetEntry(), target->ToGameObject()->GetSpawnId());
                     else
-                        target->ToGameObject()->SetRespawnTime(e.action.enableTempGO.duration);
+                        target->ToGameObject()->SetRespawnTime(e.GetAction().enableTempGO.duration);
                 }
             }
             break;
@@ -1499,7 +1502,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (Creature* npc = target->ToCreature())
                 {
                     std::array<uint32, MAX_EQUIPMENT_ITEMS> slot;
-                    if (int8 equipId = static_cast<int8>(e.action.equip.entry))
+                    if (int8 equipId = static_cast<int8>(e.GetAction().equip.entry))
                     {
                         EquipmentInfo const* eInfo = sObjectMgr->GetEquipmentInfo(npc->GetEntry(), equipId);
                         if (!eInfo)
@@ -1514,13 +1517,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     }
                     else
                     {
-                        slot[0] = e.action.equip.slot1;
-                        slot[1] = e.action.equip.slot2;
-                        slot[2] = e.action.equip.slot3;
+                        slot[0] = e.GetAction().equip.slot1;
+                        slot[1] = e.GetAction().equip.slot2;
+                        slot[2] = e.GetAction().equip.slot3;
                     }
 
                     for (uint32 i = 0; i < MAX_EQUIPMENT_ITEMS; ++i)
-                        if (!e.action.equip.mask || (e.action.equip.mask & (1 << i)))
+                        if (!e.GetAction().equip.mask || (e.GetAction().equip.mask & (1 << i)))
                             npc->SetVirtualItem(i, slot[i]);
                 }
             }
@@ -1530,13 +1533,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             SmartEvent ne = SmartEvent();
             ne.type = (SMART_EVENT)SMART_EVENT_UPDATE;
-            ne.event_chance = e.action.timeEvent.chance;
+            ne.event_chance = e.GetAction().timeEvent.chance;
             if (!ne.event_chance) ne.event_chance = 100;
 
-            ne.minMaxRepeat.min = e.action.timeEvent.min;
-            ne.minMaxRepeat.max = e.action.timeEvent.max;
-            ne.minMaxRepeat.repeatMin = e.action.timeEvent.repeatMin;
-            ne.minMaxRepeat.repeatMax = e.action.timeEvent.repeatMax;
+            ne.minMaxRepeat.min = e.GetAction().timeEvent.min;
+            ne.minMaxRepeat.max = e.GetAction().timeEvent.max;
+            ne.minMaxRepeat.repeatMin = e.GetAction().timeEvent.repeatMin;
+            ne.minMaxRepeat.repeatMax = e.GetAction().timeEvent.repeatMax;
 
             ne.event_flags = 0;
             if (!ne.minMaxRepeat.repeatMin && !ne.minMaxRepeat.repeatMax)
@@ -1544,29 +1547,31 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             SmartAction ac = SmartAction();
             ac.type = (SMART_ACTION)SMART_ACTION_TRIGGER_TIMED_EVENT;
-            ac.timeEvent.id = e.action.timeEvent.id;
+            ac.timeEvent.id = e.GetAction().timeEvent.id;
+
+            SmartScriptDefinition def;
+            def.event = ne;
+            def.event_id = e.GetAction().timeEvent.id;
+            def.target = e.GetTarget();
+            def.action = ac;
 
-            SmartScriptHolder ev = SmartScriptHolder();
-            ev.event = ne;
-            ev.event_id = e.action.timeEvent.id;
-            ev.target = e.target;
-            ev.action = ac;
+            SmartScriptHolder ev(std::make_shared<SmartScriptDefinition const>(def));
             InitTimer(ev);
             mStoredEvents.push_back(ev);
             break;
         }
         case SMART_ACTION_TRIGGER_TIMED_EVENT:
         {
-            ProcessEventsFor((SMART_EVENT)SMART_EVENT_TIMED_EVENT_TRIGGERED, nullptr, e.action.timeEvent.id);
+            ProcessEventsFor((SMART_EVENT)SMART_EVENT_TIMED_EVENT_TRIGGERED, nullptr, e.GetAction().timeEvent.id);
 
             // remove this event if not repeatable
-            if (e.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE)
-                mRemIDs.push_back(e.action.timeEvent.id);
+            if (e.GetEvent().event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE)
+                mRemIDs.push_back(e.GetAction().timeEvent.id);
             break;
         }
         case SMART_ACTION_REMOVE_TIMED_EVENT:
         {
-            mRemIDs.push_back(e.action.timeEvent.id);
+            mRemIDs.push_back(e.GetAction().timeEvent.id);
             break;
         }
         case SMART_ACTION_CALL_SCRIPT_RESET:
@@ -1580,8 +1585,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            float attackDistance = float(e.action.setRangedMovement.distance);
-            float attackAngle = float(e.action.setRangedMovement.angle) / 180.0f * float(M_PI);
+            float attackDistance = float(e.GetAction().setRangedMovement.distance);
+            float attackAngle = float(e.GetAction().setRangedMovement.angle) / 180.0f * float(M_PI);
 
             for (WorldObject* target : targets)
             {
@@ -1606,12 +1611,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (Creature* creature = target->ToCreature())
                 {
                     if (IsSmart(creature))
-                        ENSURE_AI(SmartAI, creature->AI())->SetTimedActionList(e, e.action.timedActionList.id, GetLastInvoker());
+                        ENSURE_AI(SmartAI, creature->AI())->SetTimedActionList(e, e.GetAction().timedActionList.id, GetLastInvoker());
                 }
                 else if (GameObject* goTarget = target->ToGameObject())
                 {
                     if (IsSmart(goTarget))
-                        ENSURE_AI(SmartGameObjectAI, goTarget->AI())->SetTimedActionList(e, e.action.timedActionList.id, GetLastInvoker());
+                        ENSURE_AI(SmartGameObjectAI, goTarget->AI())->SetTimedActionList(e, e.GetAction().timedActionList.id, GetLastInvoker());
                 }
             }
             break;
@@ -1620,21 +1625,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToUnit()->ReplaceAllNpcFlags(NPCFlags(e.action.flag.flag));
+                    target->ToUnit()->ReplaceAllNpcFlags(NPCFlags(e.GetAction().flag.flag));
             break;
         }
         case SMART_ACTION_ADD_NPC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToUnit()->SetNpcFlag(NPCFlags(e.action.flag.flag));
+                    target->ToUnit()->SetNpcFlag(NPCFlags(e.GetAction().flag.flag));
             break;
         }
         case SMART_ACTION_REMOVE_NPC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToUnit()->RemoveNpcFlag(NPCFlags(e.action.flag.flag));
+                    target->ToUnit()->RemoveNpcFlag(NPCFlags(e.GetAction().flag.flag));
             break;
         }
         case SMART_ACTION_CROSS_CAST:
@@ -1643,7 +1648,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             ObjectVector casters;
-            GetTargets(casters, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.action.crossCast.targetType, e.action.crossCast.targetParam1, e.action.crossCast.targetParam2, e.action.crossCast.targetParam3, 0, 0), unit);
+            GetTargets(casters, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.GetAction().crossCast.targetType, e.GetAction().crossCast.targetParam1, e.GetAction().crossCast.targetParam2, e.GetAction().crossCast.targetParam3, 0, 0), unit);
 
             for (WorldObject* caster : casters)
             {
@@ -1659,18 +1664,18 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (!IsUnit(target))
                         continue;
 
-                    if (!(e.action.crossCast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.action.crossCast.spell))
+                    if (!(e.GetAction().crossCast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.GetAction().crossCast.spell))
                     {
-                        if (!interruptedSpell && e.action.crossCast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                        if (!interruptedSpell && e.GetAction().crossCast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                         {
                             casterUnit->InterruptNonMeleeSpells(false);
                             interruptedSpell = true;
                         }
 
-                        casterUnit->CastSpell(target->ToUnit(), e.action.crossCast.spell, (e.action.crossCast.castFlags & SMARTCAST_TRIGGERED) != 0);
+                        casterUnit->CastSpell(target->ToUnit(), e.GetAction().crossCast.spell, (e.GetAction().crossCast.castFlags & SMARTCAST_TRIGGERED) != 0);
                     }
                     else
-                        TC_LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.action.crossCast.spell, target->GetGUID().ToString());
+                        TC_LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.GetAction().crossCast.spell, target->GetGUID().ToString());
                 }
             }
             break;
@@ -1678,7 +1683,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_CALL_RANDOM_TIMED_ACTIONLIST:
         {
             std::vector<uint32> actionLists;
-            std::copy_if(std::begin(e.action.randTimedActionList.actionLists), std::end(e.action.randTimedActionList.actionLists),
+            std::copy_if(std::begin(e.GetAction().randTimedActionList.actionLists), std::end(e.GetAction().randTimedActionList.actionLists),
                 std::back_inserter(actionLists), [](uint32 actionList) { return actionList != 0; });
 
             uint32 id = Trinity::Containers::SelectRandomContainerElement(actionLists);
@@ -1705,7 +1710,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_CALL_RANDOM_RANGE_TIMED_ACTIONLIST:
         {
-            uint32 id = urand(e.action.randRangeTimedActionList.idMin, e.action.randRangeTimedActionList.idMax);
+            uint32 id = urand(e.GetAction().randRangeTimedActionList.idMin, e.GetAction().randRangeTimedActionList.idMax);
             if (e.GetTargetType() == SMART_TARGET_NONE)
             {
                 TC_LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
@@ -1731,7 +1736,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsPlayer(target))
-                    target->ToPlayer()->ActivateTaxiPathTo(e.action.taxi.id);
+                    target->ToPlayer()->ActivateTaxiPathTo(e.GetAction().taxi.id);
             break;
         }
         case SMART_ACTION_RANDOM_MOVE:
@@ -1744,8 +1749,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     foundTarget = true;
 
-                    if (e.action.moveRandom.distance)
-                        target->ToCreature()->GetMotionMaster()->MoveRandom(float(e.action.moveRandom.distance));
+                    if (e.GetAction().moveRandom.distance)
+                        target->ToCreature()->GetMotionMaster()->MoveRandom(float(e.GetAction().moveRandom.distance));
                     else
                         target->ToCreature()->GetMotionMaster()->MoveIdle();
                 }
@@ -1753,8 +1758,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             if (!foundTarget && me && IsCreature(me))
             {
-                if (e.action.moveRandom.distance)
-                    me->GetMotionMaster()->MoveRandom(float(e.action.moveRandom.distance));
+                if (e.GetAction().moveRandom.distance)
+                    me->GetMotionMaster()->MoveRandom(float(e.GetAction().moveRandom.distance));
                 else
                     me->GetMotionMaster()->MoveIdle();
             }
@@ -1766,19 +1771,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    switch (e.action.setunitByte.type)
+                    switch (e.GetAction().setunitByte.type)
                     {
                         case 0:
-                            target->ToUnit()->SetStandState(UnitStandStateType(e.action.setunitByte.byte1));
+                            target->ToUnit()->SetStandState(UnitStandStateType(e.GetAction().setunitByte.byte1));
                         break;
                         case 1:
                             // pet talent points
                             break;
                         case 2:
-                            target->ToUnit()->SetVisFlag(UnitVisFlags(e.action.setunitByte.byte1));
+                            target->ToUnit()->SetVisFlag(UnitVisFlags(e.GetAction().setunitByte.byte1));
                         break;
                         case 3:
-                            target->ToUnit()->SetAnimTier(AnimTier(e.action.setunitByte.byte1));
+                            target->ToUnit()->SetAnimTier(AnimTier(e.GetAction().setunitByte.byte1));
                         break;
                     }
                 }
@@ -1791,7 +1796,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    switch (e.action.setunitByte.type)
+                    switch (e.GetAction().setunitByte.type)
                     {
                         case 0:
                             target->ToUnit()->SetStandState(UNIT_STAND_STATE_STAND);
@@ -1800,7 +1805,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                             // pet talent points
                             break;
                         case 2:
-                            target->ToUnit()->RemoveVisFlag(UnitVisFlags(e.action.setunitByte.byte1));
+                            target->ToUnit()->RemoveVisFlag(UnitVisFlags(e.GetAction().setunitByte.byte1));
                         break;
                         case 3:
                             target->ToUnit()->SetAnimTier(AnimTier::Ground);
@@ -1814,28 +1819,28 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->InterruptNonMeleeSpells(e.action.interruptSpellCasting.withDelayed != 0, e.action.interruptSpellCasting.spell_id, e.action.interruptSpellCasting.withInstant != 0);
+                    target->ToUnit()->InterruptNonMeleeSpells(e.GetAction().interruptSpellCasting.withDelayed != 0, e.GetAction().interruptSpellCasting.spell_id, e.GetAction().interruptSpellCasting.withInstant != 0);
             break;
         }
         case SMART_ACTION_JUMP_TO_POS:
         {
             for (WorldObject* target : targets)
                 if (Creature* creature = target->ToCreature())
-                    creature->GetMotionMaster()->MoveJump(e.target.x, e.target.y, e.target.z, 0.0f, float(e.action.jump.speedxy), float(e.action.jump.speedz)); // @todo add optional jump orientation support?
+                    creature->GetMotionMaster()->MoveJump(e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, 0.0f, float(e.GetAction().jump.speedxy), float(e.GetAction().jump.speedz)); // @todo add optional jump orientation support?
             break;
         }
         case SMART_ACTION_GO_SET_LOOT_STATE:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SetLootState((LootState)e.action.setGoLootState.state);
+                    target->ToGameObject()->SetLootState((LootState)e.GetAction().setGoLootState.state);
             break;
         }
         case SMART_ACTION_GO_SET_GO_STATE:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SetGoState((GOState)e.action.goState.state);
+                    target->ToGameObject()->SetGoState((GOState)e.GetAction().goState.state);
             break;
         }
         case SMART_ACTION_SEND_TARGET_TO_TARGET:
@@ -1847,7 +1852,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!ref)
                 break;
 
-            ObjectVector const* storedTargets = GetStoredTargetVector(e.action.sendTargetToTarget.id, *ref);
+            ObjectVector const* storedTargets = GetStoredTargetVector(e.GetAction().sendTargetToTarget.id, *ref);
             if (!storedTargets)
                 break;
 
@@ -1856,14 +1861,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (IsCreature(target))
                 {
                     if (SmartAI* ai = CAST_AI(SmartAI, target->ToCreature()->AI()))
-                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.action.sendTargetToTarget.id);   // store a copy of target list
+                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.GetAction().sendTargetToTarget.id);   // store a copy of target list
                     else
                         TC_LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SEND_TARGET_TO_TARGET is not using SmartAI, skipping");
                 }
                 else if (IsGameObject(target))
                 {
                     if (SmartGameObjectAI* ai = CAST_AI(SmartGameObjectAI, target->ToGameObject()->AI()))
-                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.action.sendTargetToTarget.id);   // store a copy of target list
+                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.GetAction().sendTargetToTarget.id);   // store a copy of target list
                     else
                         TC_LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SEND_TARGET_TO_TARGET is not using SmartGameObjectAI, skipping");
                 }
@@ -1876,7 +1881,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SEND_GOSSIP_MENU: gossipMenuId {}, gossipNpcTextId {}",
-                e.action.sendGossipMenu.gossipMenuId, e.action.sendGossipMenu.gossipNpcTextId);
+                e.GetAction().sendGossipMenu.gossipMenuId, e.GetAction().sendGossipMenu.gossipNpcTextId);
 
             // override default gossip
             if (me)
@@ -1888,12 +1893,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (Player* player = target->ToPlayer())
                 {
-                    if (e.action.sendGossipMenu.gossipMenuId)
-                        player->PrepareGossipMenu(GetBaseObject(), e.action.sendGossipMenu.gossipMenuId, true);
+                    if (e.GetAction().sendGossipMenu.gossipMenuId)
+                        player->PrepareGossipMenu(GetBaseObject(), e.GetAction().sendGossipMenu.gossipMenuId, true);
                     else
                         player->PlayerTalkClass->ClearMenus();
 
-                    player->PlayerTalkClass->SendGossipMenu(e.action.sendGossipMenu.gossipNpcTextId, GetBaseObject()->GetGUID());
+                    player->PlayerTalkClass->SendGossipMenu(e.GetAction().sendGossipMenu.gossipNpcTextId, GetBaseObject()->GetGUID());
                 }
             }
             break;
@@ -1907,7 +1912,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (e.GetTargetType() == SMART_TARGET_SELF)
                         target->ToCreature()->SetHomePosition(me->GetPositionX(), me->GetPositionY(), me->GetPositionZ(), me->GetOrientation());
                     else if (e.GetTargetType() == SMART_TARGET_POSITION)
-                        target->ToCreature()->SetHomePosition(e.target.x, e.target.y, e.target.z, e.target.o);
+                        target->ToCreature()->SetHomePosition(e.GetTarget().x, e.GetTarget().y, e.GetTarget().z, e.GetTarget().o);
                     else if (e.GetTargetType() == SMART_TARGET_CREATURE_RANGE || e.GetTargetType() == SMART_TARGET_CREATURE_GUID ||
                              e.GetTargetType() == SMART_TARGET_CREATURE_DISTANCE || e.GetTargetType() == SMART_TARGET_GAMEOBJECT_RANGE ||
                              e.GetTargetType() == SMART_TARGET_GAMEOBJECT_GUID || e.GetTargetType() == SMART_TARGET_GAMEOBJECT_DISTANCE ||
@@ -1928,23 +1933,23 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->SetRegenerateHealth(e.action.setHealthRegen.regenHealth != 0);
+                    target->ToCreature()->SetRegenerateHealth(e.GetAction().setHealthRegen.regenHealth != 0);
             break;
         }
         case SMART_ACTION_SET_ROOT:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->SetControlled(e.action.setRoot.root != 0, UNIT_STATE_ROOT);
+                    target->ToCreature()->SetControlled(e.GetAction().setRoot.root != 0, UNIT_STATE_ROOT);
             break;
         }
         case SMART_ACTION_SUMMON_CREATURE_GROUP:
         {
             std::list<TempSummon*> summonList;
-            GetBaseObject()->SummonCreatureGroup(e.action.creatureGroup.group, &summonList);
+            GetBaseObject()->SummonCreatureGroup(e.GetAction().creatureGroup.group, &summonList);
 
             for (TempSummon* summon : summonList)
-                if (unit && e.action.creatureGroup.attackInvoker)
+                if (unit && e.GetAction().creatureGroup.attackInvoker)
                     summon->AI()->AttackStart(unit);
             break;
         }
@@ -1952,26 +1957,26 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetPower(Powers(e.action.power.powerType), e.action.power.newPower);
+                    target->ToUnit()->SetPower(Powers(e.GetAction().power.powerType), e.GetAction().power.newPower);
             break;
         }
         case SMART_ACTION_ADD_POWER:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetPower(Powers(e.action.power.powerType), target->ToUnit()->GetPower(Powers(e.action.power.powerType)) + e.action.power.newPower);
+                    target->ToUnit()->SetPower(Powers(e.GetAction().power.powerType), target->ToUnit()->GetPower(Powers(e.GetAction().power.powerType)) + e.GetAction().power.newPower);
             break;
         }
         case SMART_ACTION_REMOVE_POWER:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetPower(Powers(e.action.power.powerType), target->ToUnit()->GetPower(Powers(e.action.power.powerType)) - e.action.power.newPower);
+                    target->ToUnit()->SetPower(Powers(e.GetAction().power.powerType), target->ToUnit()->GetPower(Powers(e.GetAction().power.powerType)) - e.GetAction().power.newPower);
             break;
         }
         case SMART_ACTION_GAME_EVENT_STOP:
         {
-            uint32 eventId = e.action.gameEventStop.id;
+            uint32 eventId = e.GetAction().gameEventStop.id;
             if (!sGameEventMgr->IsActiveEvent(eventId))
             {
                 TC_LOG_ERROR("sql.sql", "SmartScript::ProcessAction: At case SMART_ACTION_GAME_EVENT_STOP, inactive event (id: {})", eventId);
@@ -1982,7 +1987,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_GAME_EVENT_START:
         {
-            uint32 eventId = e.action.gameEventStart.id;
+            uint32 eventId = e.GetAction().gameEventStart.id;
             if (sGameEventMgr->IsActiveEvent(eventId))
             {
                 TC_LOG_ERROR("sql.sql", "SmartScript::ProcessAction: At case SMART_ACTION_GAME_EVENT_START, already activated event (id: {})", eventId);
@@ -1994,7 +1999,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_START_CLOSEST_WAYPOINT:
         {
             std::vector<uint32> waypoints;
-            std::copy_if(std::begin(e.action.closestWaypointFromList.wps), std::end(e.action.closestWaypointFromList.wps),
+            std::copy_if(std::begin(e.GetAction().closestWaypointFromList.wps), std::end(e.GetAction().closestWaypointFromList.wps),
                 std::back_inserter(waypoints), [](uint32 wp) { return wp != 0; });
 
             float distanceToClosest = std::numeric_limits<float>::max();
@@ -2034,17 +2039,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_RANDOM_SOUND:
         {
             std::vector<uint32> sounds;
-            std::copy_if(std::begin(e.action.randomSound.sounds), std::end(e.action.randomSound.sounds),
+            std::copy_if(std::begin(e.GetAction().randomSound.sounds), std::end(e.GetAction().randomSound.sounds),
                 std::back_inserter(sounds), [](uint32 sound) { return sound != 0; });
 
-            bool onlySelf = e.action.randomSound.onlySelf != 0;
+            bool onlySelf = e.GetAction().randomSound.onlySelf != 0;
             for (WorldObject* const target : targets)
             {
                 if (IsUnit(target))
                 {
                     uint32 sound = Trinity::Containers::SelectRandomContainerElement(sounds);
 
-                    if (e.action.randomSound.distance == 1)
+                    if (e.GetAction().randomSound.distance == 1)
                         target->PlayDistanceSound(sound, onlySelf ? target->ToPlayer() : nullptr);
                     else
                         target->PlayDirectSound(sound, onlySelf ? target->ToPlayer() : nullptr);
@@ -2060,20 +2065,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* const target : targets)
             {
                 if (IsCreature(target))
-                    target->ToCreature()->SetCorpseDelay(e.action.corpseDelay.timer, !e.action.corpseDelay.includeDecayRatio);
+                    target->ToCreature()->SetCorpseDelay(e.GetAction().corpseDelay.timer, !e.GetAction().corpseDelay.includeDecayRatio);
             }
 
             break;
         }
         case SMART_ACTION_SPAWN_SPAWNGROUP:
         {
-            if (e.action.groupSpawn.minDelay == 0 && e.action.groupSpawn.maxDelay == 0)
+            if (e.GetAction().groupSpawn.minDelay == 0 && e.GetAction().groupSpawn.maxDelay == 0)
             {
-                bool const ignoreRespawn = ((e.action.groupSpawn.spawnflags & SMARTAI_SPAWN_FLAGS::SMARTAI_SPAWN_FLAG_IGNORE_RESPAWN) != 0);
-                bool const force = ((e.action.groupSpawn.spawnflags & SMARTAI_SPAWN_FLAGS::SMARTAI_SPAWN_FLAG_FORCE_SPAWN) != 0);
+                bool const ignoreRespawn = ((e.GetAction().groupSpawn.spawnflags & SMARTAI_SPAWN_FLAGS::SMARTAI_SPAWN_FLAG_IGNORE_RESPAWN) != 0);
+                bool const force = ((e.GetAction().groupSpawn.spawnflags & SMARTAI_SPAWN_FLAGS::SMARTAI_SPAWN_FLAG_FORCE_SPAWN) != 0);
 
                 // Instant spawn
-                GetBaseObject()->GetMap()->SpawnGroupSpawn(e.action.groupSpawn.groupId, ignoreRespawn, force);
+                GetBaseObject()->GetMap()->SpawnGroupSpawn(e.GetAction().groupSpawn.groupId, ignoreRespawn, force);
             }
             else
             {
@@ -2082,8 +2087,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 ne.type = (SMART_EVENT)SMART_EVENT_UPDATE;
                 ne.event_chance = 100;
 
-                ne.minMaxRepeat.min = e.action.groupSpawn.minDelay;
-                ne.minMaxRepeat.max = e.action.groupSpawn.maxDelay;
+                ne.minMaxRepeat.min = e.GetAction().groupSpawn.minDelay;
+                ne.minMaxRepeat.max = e.GetAction().groupSpawn.maxDelay;
                 ne.minMaxRepeat.repeatMin = 0;
                 ne.minMaxRepeat.repeatMax = 0;
 
@@ -2092,17 +2097,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
                 SmartAction ac = SmartAction();
                 ac.type = (SMART_ACTION)SMART_ACTION_SPAWN_SPAWNGROUP;
-                ac.groupSpawn.groupId = e.action.groupSpawn.groupId;
+                ac.groupSpawn.groupId = e.GetAction().groupSpawn.groupId;
                 ac.groupSpawn.minDelay = 0;
                 ac.groupSpawn.maxDelay = 0;
-                ac.groupSpawn.spawnflags = e.action.groupSpawn.spawnflags;
-                ac.timeEvent.id = e.action.timeEvent.id;
-
-                SmartScriptHolder ev = SmartScriptHolder();
-                ev.event = ne;
-                ev.event_id = e.event_id;
-                ev.target = e.target;
-                ev.action = ac;
+                ac.groupSpawn.spawnflags = e.GetAction().groupSpawn.spawnflags;
+                ac.timeEvent.id = e.GetAction().timeEvent.id;
+
+                SmartScriptDefinition def;
+                def.event = ne;
+                def.event_id = e.event_id;
+                def.target = e.GetTarget();
+                def.action = ac;
+
+                SmartScriptHolder ev(std::make_shared<SmartScriptDefinition const>(def));
                 InitTimer(ev);
                 mStoredEvents.push_back(ev);
             }
@@ -2110,12 +2117,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_DESPAWN_SPAWNGROUP:
         {
-            if (e.action.groupSpawn.minDelay == 0 && e.action.groupSpawn.maxDelay == 0)
+            if (e.GetAction().groupSpawn.minDelay == 0 && e.GetAction().groupSpawn.maxDelay == 0)
             {
-                bool const deleteRespawnTimes = ((e.action.groupSpawn.spawnflags & SMARTAI_SPAWN_FLAGS::SMARTAI_SPAWN_FLAG_NOSAVE_RESPAWN) != 0);
+                bool const deleteRespawnTimes = ((e.GetAction().groupSpawn.spawnflags & SMARTAI_SPAWN_FLAGS::SMARTAI_SPAWN_FLAG_NOSAVE_RESPAWN) != 0);
 
                 // Instant spawn
-                GetBaseObject()->GetMap()->SpawnGroupDespawn(e.action.groupSpawn.groupId, deleteRespawnTimes);
+                GetBaseObject()->GetMap()->SpawnGroupDespawn(e.GetAction().groupSpawn.groupId, deleteRespawnTimes);
             }
             else
             {
@@ -2124,8 +2131,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 ne.type = (SMART_EVENT)SMART_EVENT_UPDATE;
                 ne.event_chance = 100;
 
-                ne.minMaxRepeat.min = e.action.groupSpawn.minDelay;
-                ne.minMaxRepeat.max = e.action.groupSpawn.maxDelay;
+                ne.minMaxRepeat.min = e.GetAction().groupSpawn.minDelay;
+                ne.minMaxRepeat.max = e.GetAction().groupSpawn.maxDelay;
                 ne.minMaxRepeat.repeatMin = 0;
                 ne.minMaxRepeat.repeatMax = 0;
 
@@ -2134,17 +2141,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
                 SmartAction ac = SmartAction();
                 ac.type = (SMART_ACTION)SMART_ACTION_DESPAWN_SPAWNGROUP;
-                ac.groupSpawn.groupId = e.action.groupSpawn.groupId;
+                ac.groupSpawn.groupId = e.GetAction().groupSpawn.groupId;
                 ac.groupSpawn.minDelay = 0;
                 ac.groupSpawn.maxDelay = 0;
-                ac.groupSpawn.spawnflags = e.action.groupSpawn.spawnflags;
-                ac.timeEvent.id = e.action.timeEvent.id;
-
-                SmartScriptHolder ev = SmartScriptHolder();
-                ev.event = ne;
-                ev.event_id = e.event_id;
-                ev.target = e.target;
-                ev.action = ac;
+                ac.groupSpawn.spawnflags = e.GetAction().groupSpawn.spawnflags;
+                ac.timeEvent.id = e.GetAction().timeEvent.id;
+
+                SmartScriptDefinition def;
+                def.event = ne;
+                def.event_id = e.event_id;
+                def.target = e.GetTarget();
+                def.action = ac;
+
+                SmartScriptHolder ev(std::make_shared<SmartScriptDefinition const>(def));
                 InitTimer(ev);
                 mStoredEvents.push_back(ev);
             }
@@ -2155,7 +2164,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            ENSURE_AI(SmartAI, me->AI())->SetEvadeDisabled(e.action.disableEvade.disable != 0);
+            ENSURE_AI(SmartAI, me->AI())->SetEvadeDisabled(e.GetAction().disableEvade.disable != 0);
             break;
         }
         case SMART_ACTION_ADD_THREAT:
@@ -2164,19 +2173,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
             for (WorldObject* const target : targets)
                 if (IsUnit(target))
-                    me->GetThreatManager().AddThreat(target->ToUnit(), float(e.action.threat.threatINC) - float(e.action.threat.threatDEC), nullptr, true, true);
+                    me->GetThreatManager().AddThreat(target->ToUnit(), float(e.GetAction().threat.threatINC) - float(e.GetAction().threat.threatDEC), nullptr, true, true);
             break;
         }
         case SMART_ACTION_LOAD_EQUIPMENT:
         {
             for (WorldObject* const target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->LoadEquipment(e.action.loadEquipment.id, e.action.loadEquipment.force != 0);
+                    target->ToCreature()->LoadEquipment(e.GetAction().loadEquipment.id, e.GetAction().loadEquipment.force != 0);
             break;
         }
         case SMART_ACTION_TRIGGER_RANDOM_TIMED_EVENT:
         {
-            uint32 eventId = urand(e.action.randomTimedEvent.minId, e.action.randomTimedEvent.maxId);
+            uint32 eventId = urand(e.GetAction().randomTimedEvent.minId, e.GetAction().randomTimedEvent.maxId);
             ProcessEventsFor((SMART_EVENT)SMART_EVENT_TIMED_EVENT_TRIGGERED, nullptr, eventId);
             break;
         }
@@ -2184,7 +2193,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* const target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->PauseMovement(e.action.pauseMovement.pauseTimer, e.action.pauseMovement.movementSlot, e.action.pauseMovement.force);
+                    target->ToUnit()->PauseMovement(e.GetAction().pauseMovement.pauseTimer, e.GetAction().pauseMovement.movementSlot, e.GetAction().pauseMovement.force);
             break;
         }
         case SMART_ACTION_RESPAWN_BY_SPAWNID:
@@ -2196,7 +2205,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 map = targets.front()->GetMap();
 
             if (map)
-                map->Respawn(SpawnObjectType(e.action.respawnData.spawnType), e.action.respawnData.spawnId);
+                map->Respawn(SpawnObjectType(e.GetAction().respawnData.spawnType), e.GetAction().respawnData.spawnId);
             else
                 TC_LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {} - tries to respawn by spawnId but does not provide a map", e.entryOrGuid, e.GetScriptType(), e.event_id);
             break;
@@ -2208,19 +2217,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->SendCinematicStart(e.action.cinematic.entry);
+                target->ToPlayer()->SendCinematicStart(e.GetAction().cinematic.entry);
             }
             break;
         }
         case SMART_ACTION_SET_MOVEMENT_SPEED:
         {
-            uint32 speedInteger = e.action.movementSpeed.speedInteger;
-            uint32 speedFraction = e.action.movementSpeed.speedFraction;
+            uint32 speedInteger = e.GetAction().movementSpeed.speedInteger;
+            uint32 speedFraction = e.GetAction().movementSpeed.speedFraction;
             float speed = float(speedInteger) + float(speedFraction) / std::pow(10, std::floor(std::log10(float(speedFraction ? speedFraction : 1)) + 1));
 
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->SetSpeed(UnitMoveType(e.action.movementSpeed.movementType), speed);
+                    target->ToCreature()->SetSpeed(UnitMoveType(e.GetAction().movementSpeed.movementType), speed);
 
             break;
         }
@@ -2228,9 +2237,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (WorldObject* obj = GetBaseObject())
             {
-                obj->GetMap()->SetZoneOverrideLight(e.action.overrideLight.zoneId, e.action.overrideLight.areaLightId, e.action.overrideLight.overrideLightId, Milliseconds(e.action.overrideLight.transitionMilliseconds));
+                obj->GetMap()->SetZoneOverrideLight(e.GetAction().overrideLight.zoneId, e.GetAction().overrideLight.areaLightId, e.GetAction().overrideLight.overrideLightId, Milliseconds(e.GetAction().overrideLight.transitionMilliseconds));
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_OVERRIDE_LIGHT: {} sets zone override light (zoneId: {}, areaLightId: {}, overrideLightId: {}, transitionMilliseconds: {})",
-                    obj->GetGUID().ToString(), e.action.overrideLight.zoneId, e.action.overrideLight.areaLightId, e.action.overrideLight.overrideLightId, e.action.overrideLight.transitionMilliseconds);
+                    obj->GetGUID().ToString(), e.GetAction().overrideLight.zoneId, e.GetAction().overrideLight.areaLightId, e.GetAction().overrideLight.overrideLightId, e.GetAction().overrideLight.transitionMilliseconds);
             }
             break;
         }
@@ -2238,9 +2247,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (WorldObject* obj = GetBaseObject())
             {
-                obj->GetMap()->SetZoneWeather(e.action.overrideWeather.zoneId, (WeatherState)e.action.overrideWeather.weatherId, float(e.action.overrideWeather.intensity));
+                obj->GetMap()->SetZoneWeather(e.GetAction().overrideWeather.zoneId, (WeatherState)e.GetAction().overrideWeather.weatherId, float(e.GetAction().overrideWeather.intensity));
                 TC_LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_OVERRIDE_WEATHER: {} sets zone weather (zoneId: {}, weatherId: {}, intensity: {})",
-                    obj->GetGUID().ToString(), e.action.overrideWeather.zoneId, e.action.overrideWeather.weatherId, e.action.overrideWeather.intensity);
+                    obj->GetGUID().ToString(), e.GetAction().overrideWeather.zoneId, e.GetAction().overrideWeather.weatherId, e.GetAction().overrideWeather.intensity);
             }
             break;
         }
@@ -2248,14 +2257,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetHover(e.action.setHover.enable != 0);
+                    target->ToUnit()->SetHover(e.GetAction().setHover.enable != 0);
             break;
         }
         case SMART_ACTION_SET_HEALTH_PCT:
         {
             for (WorldObject* target : targets)
                 if (Unit* targetUnit = target->ToUnit())
-                    targetUnit->SetHealth(targetUnit->CountPctFromMaxHealth(e.action.setHealthPct.percent));
+                    targetUnit->SetHealth(targetUnit->CountPctFromMaxHealth(e.GetAction().setHealthPct.percent));
             break;
         }
         case SMART_ACTION_SET_IMMUNE_PC:
@@ -2264,7 +2273,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.setImmunePC.immunePC)
+                    if (e.GetAction().setImmunePC.immunePC)
                         target->ToUnit()->SetUnitFlag(UNIT_FLAG_IMMUNE_TO_PC);
                     else
                         target->ToUnit()->RemoveUnitFlag(UNIT_FLAG_IMMUNE_TO_PC);
@@ -2278,7 +2287,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.setImmuneNPC.immuneNPC)
+                    if (e.GetAction().setImmuneNPC.immuneNPC)
                         target->ToUnit()->SetUnitFlag(UNIT_FLAG_IMMUNE_TO_NPC);
                     else
                         target->ToUnit()->RemoveUnitFlag(UNIT_FLAG_IMMUNE_TO_NPC);
@@ -2292,7 +2301,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.setUninteractible.uninteractible)
+                    if (e.GetAction().setUninteractible.uninteractible)
                         target->ToUnit()->SetUnitFlag(UNIT_FLAG_UNINTERACTIBLE);
                     else
                         target->ToUnit()->RemoveUnitFlag(UNIT_FLAG_UNINTERACTIBLE);
@@ -2306,7 +2315,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (GameObject* targetGo = target->ToGameObject())
                 {
-                    targetGo->ActivateObject(GameObjectActions(e.action.activateGameObject.gameObjectAction), GetBaseObject());
+                    targetGo->ActivateObject(GameObjectActions(e.GetAction().activateGameObject.gameObjectAction), GetBaseObject());
                 }
             }
             break;
@@ -2314,12 +2323,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_ADD_TO_STORED_TARGET_LIST:
         {
             if (!targets.empty())
-                AddToStoredTargetList(targets, e.action.addToStoredTargets.id);
+                AddToStoredTargetList(targets, e.GetAction().addToStoredTargets.id);
             else
             {
                 WorldObject* baseObject = GetBaseObject();
                 TC_LOG_WARN("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_ADD_TO_STORED_TARGET_LIST: var {}, baseObject {}, event {} - tried to add no targets to stored target list",
-                    e.action.addToStoredTargets.id, !baseObject ? "" : baseObject->GetName(), e.event_id);
+                    e.GetAction().addToStoredTargets.id, !baseObject ? "" : baseObject->GetName(), e.event_id);
             }
             break;
         }
@@ -2352,32 +2361,34 @@ void SmartScript::ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, ui
 
 SmartScriptHolder SmartScript::CreateSmartEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, uint32 event_param5, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 target_param4, uint32 phaseMask)
 {
-    SmartScriptHolder script;
-    script.event.type = e;
-    script.event.raw.param1 = event_param1;
-    script.event.raw.param2 = event_param2;
-    script.event.raw.param3 = event_param3;
-    script.event.raw.param4 = event_param4;
-    script.event.raw.param5 = event_param5;
-    script.event.event_phase_mask = phaseMask;
-    script.event.event_flags = event_flags;
-    script.event.event_chance = 100;
-
-    script.action.type = action;
-    script.action.raw.param1 = action_param1;
-    script.action.raw.param2 = action_param2;
-    script.action.raw.param3 = action_param3;
-    script.action.raw.param4 = action_param4;
-    script.action.raw.param5 = action_param5;
-    script.action.raw.param6 = action_param6;
-
-    script.target.type = t;
-    script.target.raw.param1 = target_param1;
-    script.target.raw.param2 = target_param2;
-    script.target.raw.param3 = target_param3;
-    script.target.raw.param4 = target_param4;
-
-    script.source_type = SMART_SCRIPT_TYPE_CREATURE;
+    SmartScriptDefinition def;
+    def.event.type = e;
+    def.event.raw.param1 = event_param1;
+    def.event.raw.param2 = event_param2;
+    def.event.raw.param3 = event_param3;
+    def.event.raw.param4 = event_param4;
+    def.event.raw.param5 = event_param5;
+    def.event.event_phase_mask = phaseMask;
+    def.event.event_flags = event_flags;
+    def.event.event_chance = 100;
+
+    def.action.type = action;
+    def.action.raw.param1 = action_param1;
+    def.action.raw.param2 = action_param2;
+    def.action.raw.param3 = action_param3;
+    def.action.raw.param4 = action_param4;
+    def.action.raw.param5 = action_param5;
+    def.action.raw.param6 = action_param6;
+
+    def.target.type = t;
+    def.target.raw.param1 = target_param1;
+    def.target.raw.param2 = target_param2;
+    def.target.raw.param3 = target_param3;
+    def.target.raw.param4 = target_param4;
+
+    def.source_type = SMART_SCRIPT_TYPE_CREATURE;
+
+    SmartScriptHolder script(std::make_shared<SmartScriptDefinition const>(def));
     InitTimer(script);
     return script;
 }
@@ -2405,55 +2416,55 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_HOSTILE_SECOND_AGGRO:
             if (me)
             {
-                if (e.target.hostilRandom.powerType)
+                if (e.GetTarget().hostilRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 1, PowerUsersSelector(me, Powers(e.target.hostilRandom.powerType - 1), float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 1, PowerUsersSelector(me, Powers(e.GetTarget().hostilRandom.powerType - 1), float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 1, float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 1, float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_HOSTILE_LAST_AGGRO:
             if (me)
             {
-                if (e.target.hostilRandom.powerType)
+                if (e.GetTarget().hostilRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, PowerUsersSelector(me, Powers(e.target.hostilRandom.powerType - 1), float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, PowerUsersSelector(me, Powers(e.GetTarget().hostilRandom.powerType - 1), float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_HOSTILE_RANDOM:
             if (me)
             {
-                if (e.target.hostilRandom.powerType)
+                if (e.GetTarget().hostilRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, PowerUsersSelector(me, Powers(e.target.hostilRandom.powerType - 1), float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, PowerUsersSelector(me, Powers(e.GetTarget().hostilRandom.powerType - 1), float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_HOSTILE_RANDOM_NOT_TOP:
             if (me)
             {
-                if (e.target.hostilRandom.powerType)
+                if (e.GetTarget().hostilRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 1, PowerUsersSelector(me, Powers(e.target.hostilRandom.powerType - 1), float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 1, PowerUsersSelector(me, Powers(e.GetTarget().hostilRandom.powerType - 1), float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 1, float(e.target.hostilRandom.maxDist), e.target.hostilRandom.playerOnly != 0))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 1, float(e.GetTarget().hostilRandom.maxDist), e.GetTarget().hostilRandom.playerOnly != 0))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_FARTHEST:
             if (me)
             {
-                if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxDistance, 0, FarthestTargetSelector(me, float(e.target.farthest.maxDist), e.target.farthest.playerOnly != 0, e.target.farthest.isInLos != 0)))
+                if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxDistance, 0, FarthestTargetSelector(me, float(e.GetTarget().farthest.maxDist), e.GetTarget().farthest.playerOnly != 0, e.GetTarget().farthest.isInLos != 0)))
                     targets.push_back(u);
             }
             break;
@@ -2488,7 +2499,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_CREATURE_RANGE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.unitRange.maxDist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.GetTarget().unitRange.maxDist));
 
             for (WorldObject* unit : units)
             {
@@ -2498,18 +2509,18 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 if (me && me->GetGUID() == unit->GetGUID())
                     continue;
 
-                if ((!e.target.unitRange.creature || unit->ToCreature()->GetEntry() == e.target.unitRange.creature) && baseObject->IsInRange(unit, float(e.target.unitRange.minDist), float(e.target.unitRange.maxDist)))
+                if ((!e.GetTarget().unitRange.creature || unit->ToCreature()->GetEntry() == e.GetTarget().unitRange.creature) && baseObject->IsInRange(unit, float(e.GetTarget().unitRange.minDist), float(e.GetTarget().unitRange.maxDist)))
                     targets.push_back(unit);
             }
 
-            if (e.target.unitRange.maxSize)
-                Trinity::Containers::RandomResize(targets, e.target.unitRange.maxSize);
+            if (e.GetTarget().unitRange.maxSize)
+                Trinity::Containers::RandomResize(targets, e.GetTarget().unitRange.maxSize);
             break;
         }
         case SMART_TARGET_CREATURE_DISTANCE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.unitDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.GetTarget().unitDistance.dist));
 
             for (WorldObject* unit : units)
             {
@@ -2519,18 +2530,18 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 if (me && me->GetGUID() == unit->GetGUID())
                     continue;
 
-                if (!e.target.unitDistance.creature || unit->ToCreature()->GetEntry() == e.target.unitDistance.creature)
+                if (!e.GetTarget().unitDistance.creature || unit->ToCreature()->GetEntry() == e.GetTarget().unitDistance.creature)
                     targets.push_back(unit);
             }
 
-            if (e.target.unitDistance.maxSize)
-                Trinity::Containers::RandomResize(targets, e.target.unitDistance.maxSize);
+            if (e.GetTarget().unitDistance.maxSize)
+                Trinity::Containers::RandomResize(targets, e.GetTarget().unitDistance.maxSize);
             break;
         }
         case SMART_TARGET_GAMEOBJECT_DISTANCE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.goDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.GetTarget().goDistance.dist));
 
             for (WorldObject* unit : units)
             {
@@ -2540,18 +2551,18 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 if (go && go->GetGUID() == unit->GetGUID())
                     continue;
 
-                if (!e.target.goDistance.entry || unit->ToGameObject()->GetEntry() == e.target.goDistance.entry)
+                if (!e.GetTarget().goDistance.entry || unit->ToGameObject()->GetEntry() == e.GetTarget().goDistance.entry)
                     targets.push_back(unit);
             }
 
-            if (e.target.goDistance.maxSize)
-                Trinity::Containers::RandomResize(targets, e.target.goDistance.maxSize);
+            if (e.GetTarget().goDistance.maxSize)
+                Trinity::Containers::RandomResize(targets, e.GetTarget().goDistance.maxSize);
             break;
         }
         case SMART_TARGET_GAMEOBJECT_RANGE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.goRange.maxDist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.GetTarget().goRange.maxDist));
 
             for (WorldObject* unit : units)
             {
@@ -2561,12 +2572,12 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 if (go && go->GetGUID() == unit->GetGUID())
                     continue;
 
-                if ((!e.target.goRange.entry || unit->ToGameObject()->GetEntry() == e.target.goRange.entry) && baseObject->IsInRange(unit, float(e.target.goRange.minDist), float(e.target.goRange.maxDist)))
+                if ((!e.GetTarget().goRange.entry || unit->ToGameObject()->GetEntry() == e.GetTarget().goRange.entry) && baseObject->IsInRange(unit, float(e.GetTarget().goRange.minDist), float(e.GetTarget().goRange.maxDist)))
                     targets.push_back(unit);
             }
 
-            if (e.target.goRange.maxSize)
-                Trinity::Containers::RandomResize(targets, e.target.goRange.maxSize);
+            if (e.GetTarget().goRange.maxSize)
+                Trinity::Containers::RandomResize(targets, e.GetTarget().goRange.maxSize);
             break;
         }
         case SMART_TARGET_CREATURE_GUID:
@@ -2577,8 +2588,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 break;
             }
 
-            if (Creature* target = FindCreatureNear(scriptTrigger ? scriptTrigger : baseObject, e.target.unitGUID.dbGuid))
-                if (!e.target.unitGUID.entry || target->GetEntry() == e.target.unitGUID.entry)
+            if (Creature* target = FindCreatureNear(scriptTrigger ? scriptTrigger : baseObject, e.GetTarget().unitGUID.dbGuid))
+                if (!e.GetTarget().unitGUID.entry || target->GetEntry() == e.GetTarget().unitGUID.entry)
                     targets.push_back(target);
             break;
         }
@@ -2590,26 +2601,26 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 break;
             }
 
-            if (GameObject* target = FindGameObjectNear(scriptTrigger ? scriptTrigger : baseObject, e.target.goGUID.dbGuid))
-                if (!e.target.goGUID.entry || target->GetEntry() == e.target.goGUID.entry)
+            if (GameObject* target = FindGameObjectNear(scriptTrigger ? scriptTrigger : baseObject, e.GetTarget().goGUID.dbGuid))
+                if (!e.GetTarget().goGUID.entry || target->GetEntry() == e.GetTarget().goGUID.entry)
                     targets.push_back(target);
             break;
         }
         case SMART_TARGET_PLAYER_RANGE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.playerRange.maxDist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.GetTarget().playerRange.maxDist));
 
             if (!units.empty() && baseObject)
                 for (WorldObject* unit : units)
-                    if (IsPlayer(unit) && baseObject->IsInRange(unit, float(e.target.playerRange.minDist), float(e.target.playerRange.maxDist)))
+                    if (IsPlayer(unit) && baseObject->IsInRange(unit, float(e.GetTarget().playerRange.minDist), float(e.GetTarget().playerRange.maxDist)))
                         targets.push_back(unit);
             break;
         }
         case SMART_TARGET_PLAYER_DISTANCE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.playerDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.GetTarget().playerDistance.dist));
 
             for (WorldObject* unit : units)
                 if (IsPlayer(unit))
@@ -2623,26 +2634,26 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 ref = scriptTrigger;
 
             if (ref)
-                if (ObjectVector const* stored = GetStoredTargetVector(e.target.stored.id, *ref))
+                if (ObjectVector const* stored = GetStoredTargetVector(e.GetTarget().stored.id, *ref))
                     targets.assign(stored->begin(), stored->end());
             break;
         }
         case SMART_TARGET_CLOSEST_CREATURE:
         {
-            if (Creature* target = baseObject->FindNearestCreature(e.target.unitClosest.entry, float(e.target.unitClosest.dist ? e.target.unitClosest.dist : 100), !e.target.unitClosest.dead))
+            if (Creature* target = baseObject->FindNearestCreature(e.GetTarget().unitClosest.entry, float(e.GetTarget().unitClosest.dist ? e.GetTarget().unitClosest.dist : 100), !e.GetTarget().unitClosest.dead))
                 targets.push_back(target);
             break;
         }
         case SMART_TARGET_CLOSEST_GAMEOBJECT:
         {
-            if (GameObject* target = baseObject->FindNearestGameObject(e.target.goClosest.entry, float(e.target.goClosest.dist ? e.target.goClosest.dist : 100)))
+            if (GameObject* target = baseObject->FindNearestGameObject(e.GetTarget().goClosest.entry, float(e.GetTarget().goClosest.dist ? e.GetTarget().goClosest.dist : 100)))
                 targets.push_back(target);
             break;
         }
         case SMART_TARGET_CLOSEST_PLAYER:
         {
             if (WorldObject* obj = GetBaseObject())
-                if (Player* target = obj->SelectNearestPlayer(float(e.target.playerDistance.dist)))
+                if (Player* target = obj->SelectNearestPlayer(float(e.GetTarget().playerDistance.dist)))
                     targets.push_back(target);
             break;
         }
@@ -2670,7 +2681,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             }
 
             // Get owner of owner
-            if (e.target.owner.useCharmerOrOwner && !targets.empty())
+            if (e.GetTarget().owner.useCharmerOrOwner && !targets.empty())
             {
                 WorldObject* owner = targets.front();
                 targets.clear();
@@ -2684,21 +2695,21 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         {
             if (me && me->CanHaveThreatList())
                 for (auto* ref : me->GetThreatManager().GetUnsortedThreatList())
-                    if (!e.target.threatList.maxDist || me->IsWithinCombatRange(ref->GetVictim(), float(e.target.threatList.maxDist)))
+                    if (!e.GetTarget().threatList.maxDist || me->IsWithinCombatRange(ref->GetVictim(), float(e.GetTarget().threatList.maxDist)))
                         targets.push_back(ref->GetVictim());
             break;
         }
         case SMART_TARGET_CLOSEST_ENEMY:
         {
             if (me)
-                if (Unit* target = me->SelectNearestTarget(e.target.closestAttackable.maxDist, e.target.closestAttackable.playerOnly != 0))
+                if (Unit* target = me->SelectNearestTarget(e.GetTarget().closestAttackable.maxDist, e.GetTarget().closestAttackable.playerOnly != 0))
                     targets.push_back(target);
             break;
         }
         case SMART_TARGET_CLOSEST_FRIENDLY:
         {
             if (me)
-                if (Unit* target = DoFindClosestFriendlyInRange(e.target.closestFriendly.maxDist, e.target.closestFriendly.playerOnly != 0))
+                if (Unit* target = DoFindClosestFriendlyInRange(e.GetTarget().closestFriendly.maxDist, e.GetTarget().closestFriendly.playerOnly != 0))
                     targets.push_back(target);
             break;
         }
@@ -2725,14 +2736,14 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         {
             if (me && me->IsVehicle())
                 for (std::pair<int8 const, VehicleSeat>& seat : me->GetVehicleKit()->Seats)
-                    if (!e.target.vehicle.seatMask || (e.target.vehicle.seatMask & (1 << seat.first)))
+                    if (!e.GetTarget().vehicle.seatMask || (e.GetTarget().vehicle.seatMask & (1 << seat.first)))
                         if (Unit* u = ObjectAccessor::GetUnit(*me, seat.second.Passenger.Guid))
                             targets.push_back(u);
             break;
         }
         case SMART_TARGET_CLOSEST_UNSPAWNED_GAMEOBJECT:
         {
-            if (GameObject* target = baseObject->FindNearestUnspawnedGameObject(e.target.goClosest.entry, float(e.target.goClosest.dist ? e.target.goClosest.dist : 100)))
+            if (GameObject* target = baseObject->FindNearestUnspawnedGameObject(e.GetTarget().goClosest.entry, float(e.GetTarget().goClosest.dist ? e.GetTarget().goClosest.dist : 100)))
                 targets.push_back(target);
             break;
         }
@@ -2759,10 +2770,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
     if (!e.active && e.GetEventType() != SMART_EVENT_LINK)
         return;
 
-    if ((e.event.event_phase_mask && !IsInPhase(e.event.event_phase_mask)) || ((e.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && e.runOnce))
+    if ((e.GetEvent().event_phase_mask && !IsInPhase(e.GetEvent().event_phase_mask)) || ((e.GetEvent().event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && e.runOnce))
         return;
 
-    if (!(e.event.event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(me))
+    if (!(e.GetEvent().event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(me))
         return;
 
     switch (e.GetEventType())
@@ -2772,26 +2783,26 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             break;
         //called from Update tick
         case SMART_EVENT_UPDATE:
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_UPDATE_OOC:
             if (me && me->IsEngaged())
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_UPDATE_IC:
             if (!me || !me->IsEngaged())
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_HEALTH_PCT:
         {
             if (!me || !me->IsEngaged() || !me->GetMaxHealth())
                 return;
             uint32 perc = (uint32)me->GetHealthPct();
-            if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
+            if (perc > e.GetEvent().minMaxRepeat.max || perc < e.GetEvent().minMaxRepeat.min)
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax);
             break;
         }
         case SMART_EVENT_MANA_PCT:
@@ -2799,9 +2810,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!me || !me->IsEngaged() || !me->GetMaxPower(POWER_MANA))
                 return;
             uint32 perc = uint32(me->GetPowerPct(POWER_MANA));
-            if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
+            if (perc > e.GetEvent().minMaxRepeat.max || perc < e.GetEvent().minMaxRepeat.min)
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax);
             break;
         }
         case SMART_EVENT_RANGE:
@@ -2809,8 +2820,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!me || !me->IsEngaged() || !me->GetVictim())
                 return;
 
-            if (me->IsInRange(me->GetVictim(), (float)e.event.minMaxRepeat.min, (float)e.event.minMaxRepeat.max))
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+            if (me->IsInRange(me->GetVictim(), (float)e.GetEvent().minMaxRepeat.min, (float)e.GetEvent().minMaxRepeat.max))
+                ProcessTimedAction(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax, me->GetVictim());
             else // make it predictable
                 RecalcTimer(e, 500, 500);
             break;
@@ -2825,12 +2836,12 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!victim || !victim->IsNonMeleeSpellCast(false, false, true))
                 return;
 
-            if (e.event.targetCasting.spellId > 0)
+            if (e.GetEvent().targetCasting.spellId > 0)
                 if (Spell* currSpell = victim->GetCurrentSpell(CURRENT_GENERIC_SPELL))
-                    if (currSpell->m_spellInfo->Id != e.event.targetCasting.spellId)
+                    if (currSpell->m_spellInfo->Id != e.GetEvent().targetCasting.spellId)
                         return;
 
-            ProcessTimedAction(e, e.event.targetCasting.repeatMin, e.event.targetCasting.repeatMax, me->GetVictim());
+            ProcessTimedAction(e, e.GetEvent().targetCasting.repeatMin, e.GetEvent().targetCasting.repeatMax, me->GetVictim());
             break;
         }
         case SMART_EVENT_FRIENDLY_IS_CC:
@@ -2839,49 +2850,49 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 return;
 
             std::vector<Creature*> creatures;
-            DoFindFriendlyCC(creatures, float(e.event.friendlyCC.radius));
+            DoFindFriendlyCC(creatures, float(e.GetEvent().friendlyCC.radius));
             if (creatures.empty())
             {
                 // if there are at least two same npcs, they will perform the same action immediately even if this is useless...
                 RecalcTimer(e, 1000, 3000);
                 return;
             }
-            ProcessTimedAction(e, e.event.friendlyCC.repeatMin, e.event.friendlyCC.repeatMax, Trinity::Containers::SelectRandomContainerElement(creatures));
+            ProcessTimedAction(e, e.GetEvent().friendlyCC.repeatMin, e.GetEvent().friendlyCC.repeatMax, Trinity::Containers::SelectRandomContainerElement(creatures));
             break;
         }
         case SMART_EVENT_FRIENDLY_MISSING_BUFF:
         {
             std::vector<Creature*> creatures;
-            DoFindFriendlyMissingBuff(creatures, float(e.event.missingBuff.radius), e.event.missingBuff.spell);
+            DoFindFriendlyMissingBuff(creatures, float(e.GetEvent().missingBuff.radius), e.GetEvent().missingBuff.spell);
 
             if (creatures.empty())
                 return;
 
-            ProcessTimedAction(e, e.event.missingBuff.repeatMin, e.event.missingBuff.repeatMax, Trinity::Containers::SelectRandomContainerElement(creatures));
+            ProcessTimedAction(e, e.GetEvent().missingBuff.repeatMin, e.GetEvent().missingBuff.repeatMax, Trinity::Containers::SelectRandomContainerElement(creatures));
             break;
         }
         case SMART_EVENT_HAS_AURA:
         {
             if (!me)
                 return;
-            uint32 count = me->GetAuraCount(e.event.aura.spell);
-            if ((!e.event.aura.count && !count) || (e.event.aura.count && count >= e.event.aura.count))
-                ProcessTimedAction(e, e.event.aura.repeatMin, e.event.aura.repeatMax);
+            uint32 count = me->GetAuraCount(e.GetEvent().aura.spell);
+            if ((!e.GetEvent().aura.count && !count) || (e.GetEvent().aura.count && count >= e.GetEvent().aura.count))
+                ProcessTimedAction(e, e.GetEvent().aura.repeatMin, e.GetEvent().aura.repeatMax);
             break;
         }
         case SMART_EVENT_TARGET_BUFFED:
         {
             if (!me || !me->GetVictim())
                 return;
-            uint32 count = me->EnsureVictim()->GetAuraCount(e.event.aura.spell);
-            if (count < e.event.aura.count)
+            uint32 count = me->EnsureVictim()->GetAuraCount(e.GetEvent().aura.spell);
+            if (count < e.GetEvent().aura.count)
                 return;
-            ProcessTimedAction(e, e.event.aura.repeatMin, e.event.aura.repeatMax, me->GetVictim());
+            ProcessTimedAction(e, e.GetEvent().aura.repeatMin, e.GetEvent().aura.repeatMax, me->GetVictim());
             break;
         }
         case SMART_EVENT_CHARMED:
         {
-            if (bvar == (e.event.charm.onRemove != 1))
+            if (bvar == (e.GetEvent().charm.onRemove != 1))
                 ProcessAction(e, unit, var0, var1, bvar, spell, gob);
             break;
         }
@@ -2908,7 +2919,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             ProcessAction(e, unit, var0, var1, bvar, spell, gob);
             break;
         case SMART_EVENT_GOSSIP_HELLO:
-            switch (e.event.gossipHello.filter)
+            switch (e.GetEvent().gossipHello.filter)
             {
                 case 0:
                     // no filter set, always execute action
@@ -2931,9 +2942,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             ProcessAction(e, unit, var0, var1, bvar, spell, gob);
             break;
         case SMART_EVENT_RECEIVE_EMOTE:
-            if (e.event.emote.emote == var0)
+            if (e.GetEvent().emote.emote == var0)
             {
-                RecalcTimer(e, e.event.emote.cooldownMin, e.event.emote.cooldownMax);
+                RecalcTimer(e, e.GetEvent().emote.cooldownMin, e.GetEvent().emote.cooldownMax);
                 ProcessAction(e, unit);
             }
             break;
@@ -2941,11 +2952,11 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         {
             if (!me || !unit)
                 return;
-            if (e.event.kill.playerOnly && unit->GetTypeId() != TYPEID_PLAYER)
+            if (e.GetEvent().kill.playerOnly && unit->GetTypeId() != TYPEID_PLAYER)
                 return;
-            if (e.event.kill.creature && unit->GetEntry() != e.event.kill.creature)
+            if (e.GetEvent().kill.creature && unit->GetEntry() != e.GetEvent().kill.creature)
                 return;
-            RecalcTimer(e, e.event.kill.cooldownMin, e.event.kill.cooldownMax);
+            RecalcTimer(e, e.GetEvent().kill.cooldownMin, e.GetEvent().kill.cooldownMax);
             ProcessAction(e, unit);
             break;
         }
@@ -2954,10 +2965,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         {
             if (!spell)
                 return;
-            if ((!e.event.spellHit.spell || spell->Id == e.event.spellHit.spell) &&
-                (!e.event.spellHit.school || (spell->SchoolMask & e.event.spellHit.school)))
+            if ((!e.GetEvent().spellHit.spell || spell->Id == e.GetEvent().spellHit.spell) &&
+                (!e.GetEvent().spellHit.school || (spell->SchoolMask & e.GetEvent().spellHit.school)))
                 {
-                    RecalcTimer(e, e.event.spellHit.cooldownMin, e.event.spellHit.cooldownMax);
+                    RecalcTimer(e, e.GetEvent().spellHit.cooldownMin, e.GetEvent().spellHit.cooldownMax);
                     ProcessAction(e, unit, 0, 0, bvar, spell, gob);
                 }
             break;
@@ -2969,10 +2980,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!spell)
                 return;
 
-            if (spell->Id != e.event.spellCast.spell)
+            if (spell->Id != e.GetEvent().spellCast.spell)
                 return;
 
-            RecalcTimer(e, e.event.spellCast.cooldownMin, e.event.spellCast.cooldownMax);
+            RecalcTimer(e, e.GetEvent().spellCast.cooldownMin, e.GetEvent().spellCast.cooldownMax);
             ProcessAction(e, nullptr, 0, 0, bvar, spell);
             break;
         }
@@ -2981,20 +2992,20 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!me || me->IsEngaged())
                 return;
             //can trigger if closer than fMaxAllowedRange
-            float range = (float)e.event.los.maxDist;
+            float range = (float)e.GetEvent().los.maxDist;
 
             //if range is ok and we are actually in LOS
             if (me->IsWithinDistInMap(unit, range) && me->IsWithinLOSInMap(unit))
             {
-                SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.event.los.hostilityMode);
+                SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.GetEvent().los.hostilityMode);
                 //if friendly event&&who is not hostile OR hostile event&&who is hostile
                 if ((hostilityMode == SmartEvent::LOSHostilityMode::Any) ||
                     (hostilityMode == SmartEvent::LOSHostilityMode::NotHostile && !me->IsHostileTo(unit)) ||
                     (hostilityMode == SmartEvent::LOSHostilityMode::Hostile && me->IsHostileTo(unit)))
                 {
-                    if (e.event.los.playerOnly && unit->GetTypeId() != TYPEID_PLAYER)
+                    if (e.GetEvent().los.playerOnly && unit->GetTypeId() != TYPEID_PLAYER)
                         return;
-                    RecalcTimer(e, e.event.los.cooldownMin, e.event.los.cooldownMax);
+                    RecalcTimer(e, e.GetEvent().los.cooldownMin, e.GetEvent().los.cooldownMax);
                     ProcessAction(e, unit);
                 }
             }
@@ -3005,20 +3016,20 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!me || !me->IsEngaged())
                 return;
             //can trigger if closer than fMaxAllowedRange
-            float range = (float)e.event.los.maxDist;
+            float range = (float)e.GetEvent().los.maxDist;
 
             //if range is ok and we are actually in LOS
             if (me->IsWithinDistInMap(unit, range) && me->IsWithinLOSInMap(unit))
             {
-                SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.event.los.hostilityMode);
+                SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.GetEvent().los.hostilityMode);
                 //if friendly event&&who is not hostile OR hostile event&&who is hostile
                 if ((hostilityMode == SmartEvent::LOSHostilityMode::Any) ||
                     (hostilityMode == SmartEvent::LOSHostilityMode::NotHostile && !me->IsHostileTo(unit)) ||
                     (hostilityMode == SmartEvent::LOSHostilityMode::Hostile && me->IsHostileTo(unit)))
                 {
-                    if (e.event.los.playerOnly && unit->GetTypeId() != TYPEID_PLAYER)
+                    if (e.GetEvent().los.playerOnly && unit->GetTypeId() != TYPEID_PLAYER)
                         return;
-                    RecalcTimer(e, e.event.los.cooldownMin, e.event.los.cooldownMax);
+                    RecalcTimer(e, e.GetEvent().los.cooldownMin, e.GetEvent().los.cooldownMax);
                     ProcessAction(e, unit);
                 }
             }
@@ -3028,9 +3039,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         {
             if (!GetBaseObject())
                 return;
-            if (e.event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_MAP && GetBaseObject()->GetMapId() != e.event.respawn.map)
+            if (e.GetEvent().respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_MAP && GetBaseObject()->GetMapId() != e.GetEvent().respawn.map)
                 return;
-            if (e.event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_AREA && GetBaseObject()->GetZoneId() != e.event.respawn.area)
+            if (e.GetEvent().respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_AREA && GetBaseObject()->GetZoneId() != e.GetEvent().respawn.area)
                 return;
             ProcessAction(e);
             break;
@@ -3040,9 +3051,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         {
             if (!IsCreature(unit))
                 return;
-            if (e.event.summoned.creature && unit->GetEntry() != e.event.summoned.creature)
+            if (e.GetEvent().summoned.creature && unit->GetEntry() != e.GetEvent().summoned.creature)
                 return;
-            RecalcTimer(e, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
+            RecalcTimer(e, e.GetEvent().summoned.cooldownMin, e.GetEvent().summoned.cooldownMax);
             ProcessAction(e, unit);
             break;
         }
@@ -3050,22 +3061,22 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_DAMAGED:
         case SMART_EVENT_DAMAGED_TARGET:
         {
-            if (var0 > e.event.minMaxRepeat.max || var0 < e.event.minMaxRepeat.min)
+            if (var0 > e.GetEvent().minMaxRepeat.max || var0 < e.GetEvent().minMaxRepeat.min)
                 return;
-            RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            RecalcTimer(e, e.GetEvent().minMaxRepeat.repeatMin, e.GetEvent().minMaxRepeat.repeatMax);
             ProcessAction(e, unit);
             break;
         }
         case SMART_EVENT_MOVEMENTINFORM:
         {
-            if ((e.event.movementInform.type && var0 != e.event.movementInform.type) || (e.event.movementInform.id && var1 != e.event.movementInform.id))
+            if ((e.GetEvent().movementInform.type && var0 != e.GetEvent().movementInform.type) || (e.GetEvent().movementInform.id && var1 != e.GetEvent().movementInform.id))
                 return;
             ProcessAction(e, unit, var0, var1);
             break;
         }
         case SMART_EVENT_TRANSPORT_RELOCATE:
         {
-            if (e.event.transportRelocate.pointID && var0 != e.event.transportRelocate.pointID)
+            if (e.GetEvent().transportRelocate.pointID && var0 != e.GetEvent().transportRelocate.pointID)
                 return;
             ProcessAction(e, unit, var0);
             break;
@@ -3076,62 +3087,62 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_WAYPOINT_STOPPED:
         case SMART_EVENT_WAYPOINT_ENDED:
         {
-            if (!me || (e.event.waypoint.pointID && var0 != e.event.waypoint.pointID) || (e.event.waypoint.pathID && var1 != e.event.waypoint.pathID))
+            if (!me || (e.GetEvent().waypoint.pointID && var0 != e.GetEvent().waypoint.pointID) || (e.GetEvent().waypoint.pathID && var1 != e.GetEvent().waypoint.pathID))
                 return;
             ProcessAction(e, unit);
             break;
         }
         case SMART_EVENT_SUMMON_DESPAWNED:
         {
-            if (e.event.summoned.creature && e.event.summoned.creature != var0)
+            if (e.GetEvent().summoned.creature && e.GetEvent().summoned.creature != var0)
                 return;
-            RecalcTimer(e, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
+            RecalcTimer(e, e.GetEvent().summoned.cooldownMin, e.GetEvent().summoned.cooldownMax);
             ProcessAction(e, unit, var0);
             break;
         }
         case SMART_EVENT_INSTANCE_PLAYER_ENTER:
         {
-            if (e.event.instancePlayerEnter.team && var0 != e.event.instancePlayerEnter.team)
+            if (e.GetEvent().instancePlayerEnter.team && var0 != e.GetEvent().instancePlayerEnter.team)
                 return;
-            RecalcTimer(e, e.event.instancePlayerEnter.cooldownMin, e.event.instancePlayerEnter.cooldownMax);
+            RecalcTimer(e, e.GetEvent().instancePlayerEnter.cooldownMin, e.GetEvent().instancePlayerEnter.cooldownMax);
             ProcessAction(e, unit, var0);
             break;
         }
         case SMART_EVENT_ACCEPTED_QUEST:
         case SMART_EVENT_REWARD_QUEST:
         {
-            if (e.event.quest.quest && var0 != e.event.quest.quest)
+            if (e.GetEvent().quest.quest && var0 != e.GetEvent().quest.quest)
                 return;
-            RecalcTimer(e, e.event.quest.cooldownMin, e.event.quest.cooldownMax);
+            RecalcTimer(e, e.GetEvent().quest.cooldownMin, e.GetEvent().quest.cooldownMax);
             ProcessAction(e, unit, var0);
             break;
         }
         case SMART_EVENT_TRANSPORT_ADDCREATURE:
         {
-            if (e.event.transportAddCreature.creature && var0 != e.event.transportAddCreature.creature)
+            if (e.GetEvent().transportAddCreature.creature && var0 != e.GetEvent().transportAddCreature.creature)
                 return;
             ProcessAction(e, unit, var0);
             break;
         }
         case SMART_EVENT_AREATRIGGER_ONTRIGGER:
         {
-            if (e.event.areatrigger.id && var0 != e.event.areatrigger.id)
+            if (e.GetEvent().areatrigger.id && var0 != e.GetEvent().areatrigger.id)
                 return;
             ProcessAction(e, unit, var0);
             break;
         }
         case SMART_EVENT_TEXT_OVER:
         {
-            if (var0 != e.event.textOver.textGroupID || (e.event.textOver.creatureEntry && e.event.textOver.creatureEntry != var1))
+            if (var0 != e.GetEvent().textOver.textGroupID || (e.GetEvent().textOver.creatureEntry && e.GetEvent().textOver.creatureEntry != var1))
                 return;
             ProcessAction(e, unit, var0);
             break;
         }
         case SMART_EVENT_DATA_SET:
         {
-            if (e.event.dataSet.id != var0 || e.event.dataSet.value != var1)
+            if (e.GetEvent().dataSet.id != var0 || e.GetEvent().dataSet.value != var1)
                 return;
-            RecalcTimer(e, e.event.dataSet.cooldownMin, e.event.dataSet.cooldownMax);
+            RecalcTimer(e, e.GetEvent().dataSet.cooldownMin, e.GetEvent().dataSet.cooldownMax);
             ProcessAction(e, unit, var0, var1);
             break;
         }
@@ -3140,20 +3151,20 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         {
             if (!unit)
                 return;
-            RecalcTimer(e, e.event.minMax.repeatMin, e.event.minMax.repeatMax);
+            RecalcTimer(e, e.GetEvent().minMax.repeatMin, e.GetEvent().minMax.repeatMax);
             ProcessAction(e, unit);
             break;
         }
         case SMART_EVENT_TIMED_EVENT_TRIGGERED:
         {
-            if (e.event.timedEvent.id == var0)
+            if (e.GetEvent().timedEvent.id == var0)
                 ProcessAction(e, unit);
             break;
         }
         case SMART_EVENT_GOSSIP_SELECT:
         {
             TC_LOG_DEBUG("scripts.ai", "SmartScript: Gossip Select:  menu {} action {}", var0, var1);//little help for scripters
-            if (e.event.gossip.sender != var0 || e.event.gossip.action != var1)
+            if (e.GetEvent().gossip.sender != var0 || e.GetEvent().gossip.action != var1)
                 return;
             ProcessAction(e, unit, var0, var1);
             break;
@@ -3161,28 +3172,28 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_GAME_EVENT_START:
         case SMART_EVENT_GAME_EVENT_END:
         {
-            if (e.event.gameEvent.gameEventId != var0)
+            if (e.GetEvent().gameEvent.gameEventId != var0)
                 return;
             ProcessAction(e, nullptr, var0);
             break;
         }
         case SMART_EVENT_GO_LOOT_STATE_CHANGED:
         {
-            if (e.event.goLootStateChanged.lootState != var0)
+            if (e.GetEvent().goLootStateChanged.lootState != var0)
                 return;
             ProcessAction(e, unit, var0, var1);
             break;
         }
         case SMART_EVENT_GO_EVENT_INFORM:
         {
-            if (e.event.eventInform.eventId != var0)
+            if (e.GetEvent().eventInform.eventId != var0)
                 return;
             ProcessAction(e, nullptr, var0);
             break;
         }
         case SMART_EVENT_ACTION_DONE:
         {
-            if (e.event.doAction.eventId != var0)
+            if (e.GetEvent().doAction.eventId != var0)
                 return;
             ProcessAction(e, unit, var0);
             break;
@@ -3211,7 +3222,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                         if (IsUnit(target) && me->IsFriendlyTo(target->ToUnit()) && target->ToUnit()->IsAlive() && target->ToUnit()->IsInCombat())
                         {
                             uint32 healthPct = uint32(target->ToUnit()->GetHealthPct());
-                            if (healthPct > e.event.friendlyHealthPct.maxHpPct || healthPct < e.event.friendlyHealthPct.minHpPct)
+                            if (healthPct > e.GetEvent().friendlyHealthPct.maxHpPct || healthPct < e.GetEvent().friendlyHealthPct.minHpPct)
                                 continue;
 
                             unitTarget = target->ToUnit();
@@ -3221,7 +3232,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     break;
                 }
                 case SMART_TARGET_ACTION_INVOKER:
-                    unitTarget = DoSelectLowestHpPercentFriendly((float)e.event.friendlyHealthPct.radius, e.event.friendlyHealthPct.minHpPct, e.event.friendlyHealthPct.maxHpPct);
+                    unitTarget = DoSelectLowestHpPercentFriendly((float)e.GetEvent().friendlyHealthPct.radius, e.GetEvent().friendlyHealthPct.minHpPct, e.GetEvent().friendlyHealthPct.maxHpPct);
                     break;
                 default:
                     return;
@@ -3230,7 +3241,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (!unitTarget)
                 return;
 
-            ProcessTimedAction(e, e.event.friendlyHealthPct.repeatMin, e.event.friendlyHealthPct.repeatMax, unitTarget);
+            ProcessTimedAction(e, e.GetEvent().friendlyHealthPct.repeatMin, e.GetEvent().friendlyHealthPct.repeatMax, unitTarget);
             break;
         }
         case SMART_EVENT_DISTANCE_CREATURE:
@@ -3240,26 +3251,26 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
 
             Creature* creature = nullptr;
 
-            if (e.event.distance.guid != 0)
+            if (e.GetEvent().distance.guid != 0)
             {
-                creature = FindCreatureNear(me, e.event.distance.guid);
+                creature = FindCreatureNear(me, e.GetEvent().distance.guid);
                 if (!creature)
                     return;
 
-                if (!me->IsInRange(creature, 0, static_cast<float>(e.event.distance.dist)))
+                if (!me->IsInRange(creature, 0, static_cast<float>(e.GetEvent().distance.dist)))
                     return;
             }
-            else if (e.event.distance.entry != 0)
+            else if (e.GetEvent().distance.entry != 0)
             {
                 std::list<Creature*> list;
-                me->GetCreatureListWithEntryInGrid(list, e.event.distance.entry, static_cast<float>(e.event.distance.dist));
+                me->GetCreatureListWithEntryInGrid(list, e.GetEvent().distance.entry, static_cast<float>(e.GetEvent().distance.dist));
 
                 if (!list.empty())
                     creature = list.front();
             }
 
             if (creature)
-                ProcessTimedAction(e, e.event.distance.repeat, e.event.distance.repeat, creature);
+                ProcessTimedAction(e, e.GetEvent().distance.repeat, e.GetEvent().distance.repeat, creature);
 
             break;
         }
@@ -3270,34 +3281,34 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
 
             GameObject* gameobject = nullptr;
 
-            if (e.event.distance.guid != 0)
+            if (e.GetEvent().distance.guid != 0)
             {
-                gameobject = FindGameObjectNear(me, e.event.distance.guid);
+                gameobject = FindGameObjectNear(me, e.GetEvent().distance.guid);
                 if (!gameobject)
                     return;
 
-                if (!me->IsInRange(gameobject, 0, static_cast<float>(e.event.distance.dist)))
+                if (!me->IsInRange(gameobject, 0, static_cast<float>(e.GetEvent().distance.dist)))
                     return;
             }
-            else if (e.event.distance.entry != 0)
+            else if (e.GetEvent().distance.entry != 0)
             {
                 std::list<GameObject*> list;
-                me->GetGameObjectListWithEntryInGrid(list, e.event.distance.entry, static_cast<float>(e.event.distance.dist));
+                me->GetGameObjectListWithEntryInGrid(list, e.GetEvent().distance.entry, static_cast<float>(e.GetEvent().distance.dist));
 
                 if (!list.empty())
                     gameobject = list.front();
             }
 
             if (gameobject)
-                ProcessTimedAction(e, e.event.distance.repeat, e.event.distance.repeat, nullptr, 0, 0, false, nullptr, gameobject);
+                ProcessTimedAction(e, e.GetEvent().distance.repeat, e.GetEvent().distance.repeat, nullptr, 0, 0, false, nullptr, gameobject);
 
             break;
         }
         case SMART_EVENT_COUNTER_SET:
-            if (e.event.counter.id != var0 || GetCounterValue(e.event.counter.id) != e.event.counter.value)
+            if (e.GetEvent().counter.id != var0 || GetCounterValue(e.GetEvent().counter.id) != e.GetEvent().counter.value)
                 return;
 
-            ProcessTimedAction(e, e.event.counter.cooldownMin, e.event.counter.cooldownMax);
+            ProcessTimedAction(e, e.GetEvent().counter.cooldownMin, e.GetEvent().counter.cooldownMax);
             break;
         default:
             TC_LOG_ERROR("sql.sql", "SmartScript::ProcessEvent: Unhandled Event type {}", e.GetEventType());
@@ -3313,11 +3324,11 @@ void SmartScript::InitTimer(SmartScriptHolder& e)
         case SMART_EVENT_UPDATE:
         case SMART_EVENT_UPDATE_IC:
         case SMART_EVENT_UPDATE_OOC:
-            RecalcTimer(e, e.event.minMaxRepeat.min, e.event.minMaxRepeat.max);
+            RecalcTimer(e, e.GetEvent().minMaxRepeat.min, e.GetEvent().minMaxRepeat.max);
             break;
         case SMART_EVENT_DISTANCE_CREATURE:
         case SMART_EVENT_DISTANCE_GAMEOBJECT:
-            RecalcTimer(e, e.event.distance.repeat, e.event.distance.repeat);
+            RecalcTimer(e, e.GetEvent().distance.repeat, e.GetEvent().distance.repeat);
             break;
         default:
             e.active = true;
@@ -3336,7 +3347,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
     if (e.GetEventType() == SMART_EVENT_LINK)
         return;
 
-    if (e.event.event_phase_mask && !IsInPhase(e.event.event_phase_mask))
+    if (e.GetEvent().event_phase_mask && !IsInPhase(e.GetEvent().event_phase_mask))
         return;
 
     if (e.GetEventType() == SMART_EVENT_UPDATE_IC && (!me || !me->IsEngaged()))
@@ -3350,7 +3361,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
         // delay spell cast event if another spell is being cast
         if (e.GetActionType() == SMART_ACTION_CAST)
         {
-            if (!(e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS))
+            if (!(e.GetAction().cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS))
             {
                 if (me && me->HasUnitState(UNIT_STATE_CASTING))
                 {
@@ -3372,44 +3383,28 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
 
         e.active = true;//activate events with cooldown
 
-        switch (e.GetEventType())//process ONLY timed events
-        {
-            case SMART_EVENT_UPDATE:
-            case SMART_EVENT_UPDATE_OOC:
-            case SMART_EVENT_UPDATE_IC:
-            case SMART_EVENT_HEALTH_PCT:
-            case SMART_EVENT_MANA_PCT:
-            case SMART_EVENT_RANGE:
-            case SMART_EVENT_VICTIM_CASTING:
-            case SMART_EVENT_FRIENDLY_IS_CC:
-            case SMART_EVENT_FRIENDLY_MISSING_BUFF:
-            case SMART_EVENT_HAS_AURA:
-            case SMART_EVENT_TARGET_BUFFED:
-            case SMART_EVENT_FRIENDLY_HEALTH_PCT:
-            case SMART_EVENT_DISTANCE_CREATURE:
-            case SMART_EVENT_DISTANCE_GAMEOBJECT:
-            {
-                if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
-                {
-                    Unit* invoker = nullptr;
-                    if (me && mTimedActionListInvoker)
-                        invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
-                    ProcessEvent(e, invoker);
-                    e.enableTimed = false;//disable event if it is in an ActionList and was processed once
-                    for (SmartScriptHolder& scriptholder : mTimedActionList)
+        bool const isTimedEvent = SmartEventDispatchTable::IsTimedEvent(SMART_EVENT(e.GetEventType()));
+        if (isTimedEvent)//process ONLY timed events
+        {
+            if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+            {
+                Unit* invoker = nullptr;
+                if (me && mTimedActionListInvoker)
+                    invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
+                ProcessEvent(e, invoker);
+                e.enableTimed = false;//disable event if it is in an ActionList and was processed once
+                for (SmartScriptHolder& scriptholder : mTimedActionList)
+                {
+                    //find the first event which is not the current one and enable it
+                    if (scriptholder.event_id > e.event_id)
                     {
-                        //find the first event which is not the current one and enable it
-                        if (scriptholder.event_id > e.event_id)
-                        {
-                            scriptholder.enableTimed = true;
-                            break;
-                        }
+                        scriptholder.enableTimed = true;
+                        break;
                     }
                 }
-                else
-                    ProcessEvent(e);
-                break;
             }
+            else
+                ProcessEvent(e);
         }
 
         if (e.priority != SmartScriptHolder::DEFAULT_PRIORITY)
@@ -3423,6 +3418,10 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
                 e.priority = SmartScriptHolder::DEFAULT_PRIORITY;
             }
         }
+
+        // cooldown of a non timed event is over, nothing left to count down until it fires again
+        if (!isTimedEvent)
+            e.timer = 0;
     }
     else
         e.timer -= diff;
@@ -3441,9 +3440,51 @@ void SmartScript::InstallEvents()
             mEvents.push_back(installevent);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        RebuildEventTable();
     }
 }
 
+void SmartScript::RebuildEventTable()
+{
+    mEventTable.Build(mEvents);
+
+    mArmedEvents.clear();
+    for (uint32 pos = 0; pos < mEvents.size(); ++pos)
+        if (mEvents[pos].timer && !SmartEventDispatchTable::IsTimedEvent(SMART_EVENT(mEvents[pos].GetEventType())))
+            mArmedEvents.push_back(pos);
+}
+
+void SmartScript::ArmEvent(uint32 pos)
+{
+    SMART_EVENT type = SMART_EVENT(mEvents[pos].GetEventType());
+    if (type == SMART_EVENT_LINK || SmartEventDispatchTable::IsTimedEvent(type))
+        return;
+
+    auto itr = std::lower_bound(mArmedEvents.begin(), mArmedEvents.end(), pos);
+    if (itr == mArmedEvents.end() || *itr != pos)
+        mArmedEvents.insert(itr, pos);
+}
+
+uint32 SmartScript::GetNextTimedEvent(uint32 from) const
+{
+    uint32 next = mEvents.size();
+    auto consider = [from, &next](std::span<uint32 const> positions)
+    {
+        auto itr = std::lower_bound(positions.begin(), positions.end(), from);
+        if (itr != positions.end())
+            next = std::min(next, *itr);
+    };
+
+    consider(mEventTable.GetTimedEvents());
+    // UpdateTimer would skip the other one anyway, combat state is checked again for every step
+    if (me && me->IsEngaged())
+        consider(mEventTable.GetCombatTimedEvents());
+    else
+        consider(mEventTable.GetIdleTimedEvents());
+    consider(mArmedEvents);
+    return next;
+}
+
 void SmartScript::RemoveStoredEvent(uint32 id)
 {
     if (!mStoredEvents.empty())
@@ -3536,11 +3577,15 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        RebuildEventTable();
         mEventSortingRequired = false;
     }
 
-    for (SmartScriptHolder& mEvent : mEvents)
-        UpdateTimer(mEvent, diff);
+    // events are only added or reordered above, positions stay valid for the whole loop
+    for (uint32 pos = GetNextTimedEvent(0); pos < mEvents.size(); pos = GetNextTimedEvent(pos + 1))
+        UpdateTimer(mEvents[pos], diff);
+
+    std::erase_if(mArmedEvents, [this](uint32 pos) { return !mEvents[pos].timer; });
 
     if (!mStoredEvents.empty())
     {
@@ -3615,12 +3660,12 @@ void SmartScript::RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll)
 
     // This allows to retry the action later without rolling again the chance roll (which might fail and end up not executing the action)
     if (ignoreChanceRoll)
-        e.event.event_flags |= SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL;
+        e.ignoreChanceRoll = true;
 
     e.runOnce = false;
 }
 
-void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEntry const* at)
+void SmartScript::FillScript(SmartAIEventList const& e, WorldObject* obj, AreaTriggerEntry const* at)
 {
     if (e.empty())
     {
@@ -3630,48 +3675,45 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEn
             TC_LOG_DEBUG("scripts.ai", "SmartScript: EventMap for AreaTrigger {} is empty but is using SmartScript.", at->ID);
         return;
     }
-    for (SmartScriptHolder& scriptholder : e)
+    mEvents.reserve(mEvents.size() + e.size());
+    for (SmartScriptHolder const& scriptholder : e)
     {
         #ifndef TRINITY_DEBUG
-            if (scriptholder.event.event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
+            if (scriptholder.GetEvent().event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
                 continue;
         #endif
 
-        if (scriptholder.event.event_flags & SMART_EVENT_FLAG_DIFFICULTY_ALL)//if has instance flag add only if in it
+        if (scriptholder.GetEvent().event_flags & SMART_EVENT_FLAG_DIFFICULTY_ALL)//if has instance flag add only if in it
         {
             if (!(obj && obj->GetMap()->IsDungeon()))
                 continue;
 
-            if (!(1 << (obj->GetMap()->GetSpawnMode() + 1) & scriptholder.event.event_flags))
+            if (!(1 << (obj->GetMap()->GetSpawnMode() + 1) & scriptholder.GetEvent().event_flags))
                 continue;
         }
-        mAllEventFlags |= scriptholder.event.event_flags;
+        mAllEventFlags |= scriptholder.GetEvent().event_flags;
         mEvents.push_back(scriptholder);//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
 }
 
 void SmartScript::GetScript()
 {
-    SmartAIEventList e;
     if (me)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
-        if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
-        FillScript(e, me, nullptr);
+        SmartAIEventList const* e = &sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
+        if (e->empty())
+            e = &sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+        FillScript(*e, me, nullptr);
     }
     else if (go)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
-        if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
-        FillScript(e, go, nullptr);
+        SmartAIEventList const* e = &sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
+        if (e->empty())
+            e = &sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
+        FillScript(*e, go, nullptr);
     }
     else if (trigger)
-    {
-        e = sSmartScriptMgr->GetScript((int32)trigger->ID, mScriptType);
-        FillScript(e, nullptr, trigger);
-    }
+        FillScript(sSmartScriptMgr->GetScript((int32)trigger->ID, mScriptType), nullptr, trigger);
 }
 
 void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at)
@@ -3717,6 +3759,8 @@ void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at)
     for (SmartScriptHolder& event : mEvents)
         InitTimer(event);//calculate timers for first time use
 
+    RebuildEventTable();
+
     ProcessEventsFor(SMART_EVENT_AI_INIT);
     InstallEvents();
     ProcessEventsFor(SMART_EVENT_JUST_CREATED);
@@ -3799,7 +3843,7 @@ void SmartScript::SetTimedActionList(SmartScriptHolder& e, uint32 entry, Unit* i
     }
 
     // Do NOT allow to start a new actionlist if a previous one is already running, unless explicitly allowed. We need to always finish the current actionlist
-    if (!e.action.timedActionList.allowOverride && !mTimedActionList.empty())
+    if (!e.GetAction().timedActionList.allowOverride && !mTimedActionList.empty())
         return;
 
     mTimedActionList.clear();
@@ -3811,12 +3855,12 @@ void SmartScript::SetTimedActionList(SmartScriptHolder& e, uint32 entry, Unit* i
     {
         i->enableTimed = i == mTimedActionList.begin();//enable processing only for the first action
 
-        if (e.action.timedActionList.timerType == 0)
-            i->event.type = SMART_EVENT_UPDATE_OOC;
-        else if (e.action.timedActionList.timerType == 1)
-            i->event.type = SMART_EVENT_UPDATE_IC;
-        else if (e.action.timedActionList.timerType > 1)
-            i->event.type = SMART_EVENT_UPDATE;
+        if (e.GetAction().timedActionList.timerType == 0)
+            i->eventType = SMART_EVENT_UPDATE_OOC;
+        else if (e.GetAction().timedActionList.timerType == 1)
+            i->eventType = SMART_EVENT_UPDATE_IC;
+        else if (e.GetAction().timedActionList.timerType > 1)
+            i->eventType = SMART_EVENT_UPDATE;
 
         InitTimer((*i));
     }
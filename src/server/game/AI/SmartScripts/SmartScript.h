@@ -37,7 +37,7 @@ class TC_GAME_API SmartScript
 
         void OnInitialize(WorldObject* obj, AreaTriggerEntry const* at = nullptr);
         void GetScript();
-        void FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEntry const* at);
+        void FillScript(SmartAIEventList const& e, WorldObject* obj, AreaTriggerEntry const* at);
 
         void ProcessEventsFor(SMART_EVENT e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
         void ProcessEvent(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
@@ -105,7 +105,14 @@ class TC_GAME_API SmartScript
         void RaisePriority(SmartScriptHolder& e);
         void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
+        void RebuildEventTable();
+        void ArmEvent(uint32 pos);
+        uint32 GetNextTimedEvent(uint32 from) const;
+
         SmartAIEventList mEvents;
+        SmartEventDispatchTable mEventTable;
+        // positions of non timed events with a running cooldown, sorted
+        std::vector<uint32> mArmedEvents;
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
@@ -143,7 +143,7 @@ void SmartAIMgr::LoadSmartAIFromDB()
     {
         Field* fields = result->Fetch();
 
-        SmartScriptHolder temp;
+        SmartScriptDefinition temp;
 
         temp.entryOrGuid = fields[0].GetInt32();
         if (!temp.entryOrGuid)
@@ -354,7 +354,7 @@ void SmartAIMgr::LoadSmartAIFromDB()
             mEventMap[source_type][temp.entryOrGuid] = eventList;
         }
         // store the new event
-        mEventMap[source_type][temp.entryOrGuid].push_back(temp);
+        mEventMap[source_type][temp.entryOrGuid].emplace_back(std::make_shared<SmartScriptDefinition const>(temp));
     }
     while (result->NextRow());
 
@@ -391,16 +391,87 @@ void SmartAIMgr::LoadSmartAIFromDB()
     UnLoadHelperStores();
 }
 
-SmartAIEventList SmartAIMgr::GetScript(int32 entry, SmartScriptType type)
+SmartAIEventList const& SmartAIMgr::GetScript(int32 entry, SmartScriptType type) const
 {
-    SmartAIEventList temp;
-    if (mEventMap[uint32(type)].find(entry) != mEventMap[uint32(type)].end())
-        return mEventMap[uint32(type)][entry];
-    else
+    auto itr = mEventMap[uint32(type)].find(entry);
+    if (itr != mEventMap[uint32(type)].end())
+        return itr->second;
+
+    if (entry > 0)//first search is for guid (negative), do not drop error if not found
+        TC_LOG_DEBUG("scripts.ai", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
+
+    static SmartAIEventList const EmptyEventList;
+    return EmptyEventList;
+}
+
+void SmartEventDispatchTable::Build(SmartAIEventList const& events)
+{
+    ASSERT(events.size() <= std::numeric_limits<uint16>::max());
+
+    _offsets.fill(0);
+    _timedEvents.clear();
+    _combatTimedEvents.clear();
+    _idleTimedEvents.clear();
+
+    // counting sort by event type, keeps list order inside each bucket
+    for (SmartScriptHolder const& e : events)
+        if (e.GetEventType() < SMART_EVENT_END)
+            ++_offsets[e.GetEventType() + 1];
+
+    for (uint32 i = 1; i < _offsets.size(); ++i)
+        _offsets[i] += _offsets[i - 1];
+
+    _eventsByType.resize(_offsets[SMART_EVENT_END]);
+
+    std::array<uint16, SMART_EVENT_END> cursors;
+    std::copy_n(_offsets.begin(), cursors.size(), cursors.begin());
+
+    for (uint32 pos = 0; pos < events.size(); ++pos)
+    {
+        SMART_EVENT type = SMART_EVENT(events[pos].GetEventType());
+        if (type >= SMART_EVENT_END)
+            continue;
+
+        _eventsByType[cursors[type]++] = pos;
+
+        if (type == SMART_EVENT_UPDATE_IC)
+            _combatTimedEvents.push_back(pos);
+        else if (type == SMART_EVENT_UPDATE_OOC)
+            _idleTimedEvents.push_back(pos);
+        else if (IsTimedEvent(type))
+            _timedEvents.push_back(pos);
+    }
+}
+
+std::span<uint32 const> SmartEventDispatchTable::GetEvents(SMART_EVENT type) const
+{
+    if (type >= SMART_EVENT_END)
+        return {};
+
+    return std::span<uint32 const>(_eventsByType.data() + _offsets[type], _offsets[type + 1] - _offsets[type]);
+}
+
+bool SmartEventDispatchTable::IsTimedEvent(SMART_EVENT type)
+{
+    switch (type)
     {
-        if (entry > 0)//first search is for guid (negative), do not drop error if not found
-            TC_LOG_DEBUG("scripts.ai", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
-        return temp;
+        case SMART_EVENT_UPDATE:
+        case SMART_EVENT_UPDATE_OOC:
+        case SMART_EVENT_UPDATE_IC:
+        case SMART_EVENT_HEALTH_PCT:
+        case SMART_EVENT_MANA_PCT:
+        case SMART_EVENT_RANGE:
+        case SMART_EVENT_VICTIM_CASTING:
+        case SMART_EVENT_FRIENDLY_IS_CC:
+        case SMART_EVENT_FRIENDLY_MISSING_BUFF:
+        case SMART_EVENT_HAS_AURA:
+        case SMART_EVENT_TARGET_BUFFED:
+        case SMART_EVENT_FRIENDLY_HEALTH_PCT:
+        case SMART_EVENT_DISTANCE_CREATURE:
+        case SMART_EVENT_DISTANCE_GAMEOBJECT:
+            return true;
+        default:
+            return false;
     }
 }
 
@@ -474,7 +545,7 @@ SmartScriptHolder& SmartAIMgr::FindLinkedEvent(SmartAIEventList& list, uint32 li
     }
 }
 
-bool SmartAIMgr::IsTargetValid(SmartScriptHolder const& e)
+bool SmartAIMgr::IsTargetValid(SmartScriptDefinition const& e)
 {
     if (std::abs(e.target.o) > 2 * float(M_PI))
         TC_LOG_ERROR("sql.sql", "SmartAIMgr: Entry {} SourceType {} Event {} Action {} has abs(`target.o` = {}) > 2*PI (orientation is expressed in radians)",
@@ -578,7 +649,7 @@ bool SmartAIMgr::IsTargetValid(SmartScriptHolder const& e)
     return true;
 }
 
-bool SmartAIMgr::IsMinMaxValid(SmartScriptHolder const& e, uint32 min, uint32 max)
+bool SmartAIMgr::IsMinMaxValid(SmartScriptDefinition const& e, uint32 min, uint32 max)
 {
     if (max < min)
     {
@@ -588,7 +659,7 @@ bool SmartAIMgr::IsMinMaxValid(SmartScriptHolder const& e, uint32 min, uint32 ma
     return true;
 }
 
-bool SmartAIMgr::NotNULL(SmartScriptHolder const& e, uint32 data)
+bool SmartAIMgr::NotNULL(SmartScriptDefinition const& e, uint32 data)
 {
     if (!data)
     {
@@ -598,7 +669,7 @@ bool SmartAIMgr::NotNULL(SmartScriptHolder const& e, uint32 data)
     return true;
 }
 
-bool SmartAIMgr::IsCreatureValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsCreatureValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sObjectMgr->GetCreatureTemplate(entry))
     {
@@ -608,7 +679,7 @@ bool SmartAIMgr::IsCreatureValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsQuestValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsQuestValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sObjectMgr->GetQuestTemplate(entry))
     {
@@ -618,7 +689,7 @@ bool SmartAIMgr::IsQuestValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsGameObjectValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsGameObjectValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sObjectMgr->GetGameObjectTemplate(entry))
     {
@@ -628,7 +699,7 @@ bool SmartAIMgr::IsGameObjectValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsSpellValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsSpellValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sSpellMgr->GetSpellInfo(entry))
     {
@@ -638,7 +709,7 @@ bool SmartAIMgr::IsSpellValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsItemValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsItemValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sItemStore.LookupEntry(entry))
     {
@@ -648,7 +719,7 @@ bool SmartAIMgr::IsItemValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsTextEmoteValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsTextEmoteValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sEmotesTextStore.LookupEntry(entry))
     {
@@ -658,7 +729,7 @@ bool SmartAIMgr::IsTextEmoteValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsEmoteValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsEmoteValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sEmotesStore.LookupEntry(entry))
     {
@@ -668,7 +739,7 @@ bool SmartAIMgr::IsEmoteValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsAreaTriggerValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsAreaTriggerValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sAreaTriggerStore.LookupEntry(entry))
     {
@@ -678,7 +749,7 @@ bool SmartAIMgr::IsAreaTriggerValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::IsSoundValid(SmartScriptHolder const& e, uint32 entry)
+bool SmartAIMgr::IsSoundValid(SmartScriptDefinition const& e, uint32 entry)
 {
     if (!sSoundEntriesStore.LookupEntry(entry))
     {
@@ -688,7 +759,7 @@ bool SmartAIMgr::IsSoundValid(SmartScriptHolder const& e, uint32 entry)
     return true;
 }
 
-bool SmartAIMgr::CheckUnusedEventParams(SmartScriptHolder const& e)
+bool SmartAIMgr::CheckUnusedEventParams(SmartScriptDefinition const& e)
 {
     size_t paramsStructSize = [&]() -> size_t
     {
@@ -798,7 +869,7 @@ bool SmartAIMgr::CheckUnusedEventParams(SmartScriptHolder const& e)
     return true;
 }
 
-bool SmartAIMgr::CheckUnusedActionParams(SmartScriptHolder const& e)
+bool SmartAIMgr::CheckUnusedActionParams(SmartScriptDefinition const& e)
 {
     size_t paramsStructSize = [&]() -> size_t
     {
@@ -958,7 +1029,7 @@ bool SmartAIMgr::CheckUnusedActionParams(SmartScriptHolder const& e)
     return true;
 }
 
-bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptHolder const& e)
+bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptDefinition const& e)
 {
     size_t paramsStructSize = [&]() -> size_t
     {
@@ -1019,7 +1090,7 @@ bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptHolder const& e)
     return true;
 }
 
-bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
+bool SmartAIMgr::IsEventValid(SmartScriptDefinition& e)
 {
     if (e.event.type >= SMART_EVENT_END)
     {
@@ -2155,7 +2226,7 @@ bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
     return true;
 }
 
-bool SmartAIMgr::IsTextValid(SmartScriptHolder const& e, uint32 id)
+bool SmartAIMgr::IsTextValid(SmartScriptDefinition const& e, uint32 id)
 {
     if (e.GetScriptType() != SMART_SCRIPT_TYPE_CREATURE)
         return true;
@@ -23,8 +23,11 @@
 #include "ObjectGuid.h"
 #include "WaypointDefines.h"
 #include "advstd.h"
+#include <array>
 #include <limits>
 #include <map>
+#include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 
@@ -1534,9 +1537,6 @@ enum SmartEventFlags
 
     SMART_EVENT_FLAG_DIFFICULTY_ALL        = (SMART_EVENT_FLAG_DIFFICULTY_0|SMART_EVENT_FLAG_DIFFICULTY_1|SMART_EVENT_FLAG_DIFFICULTY_2|SMART_EVENT_FLAG_DIFFICULTY_3),
     SMART_EVENT_FLAGS_ALL                  = (SMART_EVENT_FLAG_NOT_REPEATABLE|SMART_EVENT_FLAG_DIFFICULTY_ALL|SMART_EVENT_FLAG_RESERVED_5|SMART_EVENT_FLAG_RESERVED_6|SMART_EVENT_FLAG_DEBUG_ONLY|SMART_EVENT_FLAG_DONT_RESET|SMART_EVENT_FLAG_WHILE_CHARMED),
-
-    // Temp flags, used only at runtime, never stored in DB
-    SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL = 0x40000000,              //Event occurs no matter what roll_chance_i(e.event.event_chance) returns.
 };
 
 enum SmartCastFlags
@@ -1551,11 +1551,10 @@ enum SmartCastFlags
 };
 
 // one line in DB is one event
-struct SmartScriptHolder
+struct SmartScriptDefinition
 {
-    SmartScriptHolder() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
-        , event_id(0), link(0), event(), action(), target(), timer(0), priority(DEFAULT_PRIORITY), active(false), runOnce(false)
-        , enableTimed(false) { }
+    SmartScriptDefinition() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
+        , event_id(0), link(0), event(), action(), target() { }
 
     int32 entryOrGuid;
     SmartScriptType source_type;
@@ -1570,12 +1569,44 @@ struct SmartScriptHolder
     uint32 GetEventType() const { return (uint32)event.type; }
     uint32 GetActionType() const { return (uint32)action.type; }
     uint32 GetTargetType() const { return (uint32)target.type; }
+};
+
+// one event of a running script, the definition is shared read-only by every object using the script
+struct SmartScriptHolder
+{
+    SmartScriptHolder() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
+        , event_id(0), link(0), eventType(), timer(0), priority(DEFAULT_PRIORITY), active(false), runOnce(false)
+        , enableTimed(false), ignoreChanceRoll(false) { }
+
+    explicit SmartScriptHolder(std::shared_ptr<SmartScriptDefinition const> def) : definition(std::move(def))
+        , entryOrGuid(definition->entryOrGuid), source_type(definition->source_type), event_id(definition->event_id), link(definition->link)
+        , eventType(definition->event.type), timer(0), priority(DEFAULT_PRIORITY), active(false), runOnce(false)
+        , enableTimed(false), ignoreChanceRoll(false) { }
+
+    std::shared_ptr<SmartScriptDefinition const> definition;
+
+    // copied from definition, keeps sorting and lookups off the shared data
+    int32 entryOrGuid;
+    SmartScriptType source_type;
+    uint32 event_id;
+    uint32 link;
+    SMART_EVENT eventType;                                  // timed action lists override the type of their definition
+
+    SmartEvent const& GetEvent() const { return definition->event; }
+    SmartAction const& GetAction() const { return definition->action; }
+    SmartTarget const& GetTarget() const { return definition->target; }
+
+    uint32 GetScriptType() const { return (uint32)source_type; }
+    uint32 GetEventType() const { return (uint32)eventType; }
+    uint32 GetActionType() const { return (uint32)definition->action.type; }
+    uint32 GetTargetType() const { return (uint32)definition->target.type; }
 
     uint32 timer;
     uint32 priority;
     bool active;
     bool runOnce;
     bool enableTimed;
+    bool ignoreChanceRoll;                                  // next run occurs no matter what roll_chance_i(event_chance) returns
 
     operator bool() const { return entryOrGuid != 0; }
     // Default comparision operator using priority field as first ordering field
@@ -1648,6 +1679,35 @@ typedef std::vector<SmartScriptHolder> SmartAIEventStoredList;
 // all events for all entries / guids
 typedef std::unordered_map<int32, SmartAIEventList> SmartAIEventMap;
 
+// Positions of a script's events bucketed by event type, so ProcessEventsFor and
+// the per-tick timer update only visit holders that can react.
+// Must be rebuilt whenever the indexed list is reordered or grows.
+class TC_GAME_API SmartEventDispatchTable
+{
+    public:
+        SmartEventDispatchTable() { _offsets.fill(0); }
+
+        void Build(SmartAIEventList const& events);
+
+        // positions of all events of the given type, in list order
+        std::span<uint32 const> GetEvents(SMART_EVENT type) const;
+
+        // positions of events whose timer drives them, in list order
+        // SMART_EVENT_UPDATE_IC and SMART_EVENT_UPDATE_OOC are kept apart as only one of them can tick at a time
+        std::span<uint32 const> GetTimedEvents() const { return _timedEvents; }
+        std::span<uint32 const> GetCombatTimedEvents() const { return _combatTimedEvents; }
+        std::span<uint32 const> GetIdleTimedEvents() const { return _idleTimedEvents; }
+
+        static bool IsTimedEvent(SMART_EVENT type);
+
+    private:
+        std::vector<uint32> _eventsByType;
+        std::array<uint16, SMART_EVENT_END + 1> _offsets;
+        std::vector<uint32> _timedEvents;
+        std::vector<uint32> _combatTimedEvents;
+        std::vector<uint32> _idleTimedEvents;
+};
+
 // Helper Stores
 typedef std::map<uint32 /*entry*/, std::pair<uint32 /*spellId*/, SpellEffIndex /*effIndex*/> > CacheSpellContainer;
 typedef std::pair<CacheSpellContainer::const_iterator, CacheSpellContainer::const_iterator> CacheSpellContainerBounds;
@@ -1663,7 +1723,7 @@ class TC_GAME_API SmartAIMgr
 
         void LoadSmartAIFromDB();
 
-        SmartAIEventList GetScript(int32 entry, SmartScriptType type);
+        SmartAIEventList const& GetScript(int32 entry, SmartScriptType type) const;
 
         static SmartScriptHolder& FindLinkedSourceEvent(SmartAIEventList& list, uint32 eventId);
 
@@ -1675,26 +1735,26 @@ class TC_GAME_API SmartAIMgr
 
         static bool EventHasInvoker(SMART_EVENT event);
 
-        bool IsEventValid(SmartScriptHolder& e);
-        bool IsTargetValid(SmartScriptHolder const& e);
-
-        static bool IsMinMaxValid(SmartScriptHolder const& e, uint32 min, uint32 max);
-
-        static bool NotNULL(SmartScriptHolder const& e, uint32 data);
-        static bool IsCreatureValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsQuestValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsGameObjectValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsSpellValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsItemValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsTextEmoteValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsEmoteValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsAreaTriggerValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsSoundValid(SmartScriptHolder const& e, uint32 entry);
-        static bool IsTextValid(SmartScriptHolder const& e, uint32 id);
-
-        static bool CheckUnusedEventParams(SmartScriptHolder const& e);
-        static bool CheckUnusedActionParams(SmartScriptHolder const& e);
-        static bool CheckUnusedTargetParams(SmartScriptHolder const& e);
+        bool IsEventValid(SmartScriptDefinition& e);
+        bool IsTargetValid(SmartScriptDefinition const& e);
+
+        static bool IsMinMaxValid(SmartScriptDefinition const& e, uint32 min, uint32 max);
+
+        static bool NotNULL(SmartScriptDefinition const& e, uint32 data);
+        static bool IsCreatureValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsQuestValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsGameObjectValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsSpellValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsItemValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsTextEmoteValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsEmoteValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsAreaTriggerValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsSoundValid(SmartScriptDefinition const& e, uint32 entry);
+        static bool IsTextValid(SmartScriptDefinition const& e, uint32 id);
+
+        static bool CheckUnusedEventParams(SmartScriptDefinition const& e);
+        static bool CheckUnusedActionParams(SmartScriptDefinition const& e);
+        static bool CheckUnusedTargetParams(SmartScriptDefinition const& e);
 
         // Helpers
         void LoadHelperStores();
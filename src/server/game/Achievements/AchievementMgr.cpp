@@ -35,6 +35,7 @@
 #include "Mail.h"
 #include "Map.h"
 #include "MapManager.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "RBAC.h"
@@ -482,6 +483,7 @@ bool AchievementCriteriaDataSet::Meets(Player const* source, WorldObject const*
 
 AchievementMgr::AchievementMgr(Player* player) : m_player(player), m_achievementPoints(0)
 {
+    BuildOpenCriteriaIndex();
 }
 
 AchievementMgr::~AchievementMgr() { }
@@ -506,6 +508,7 @@ void AchievementMgr::Reset()
     m_achievementPoints = 0;
     m_criteriaProgress.clear();
     DeleteFromDB(m_player->GetGUID());
+    BuildOpenCriteriaIndex();
 
     // re-fill data
     CheckAllAchievementCriteria();
@@ -665,6 +668,55 @@ void AchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, PreparedQ
             progress.changed = false;
         } while (criteriaResult->NextRow());
     }
+
+    BuildOpenCriteriaIndex();
+}
+
+bool AchievementMgr::IsCriteriaClosed(AchievementCriteriaEntry const* criteria) const
+{
+    if (!HasAchieved(criteria->AchievementID))
+        return false;
+
+    // achievements sharing criteria of a completed one (counters included) still need its progress
+    if (AchievementEntryList const* sharingAchievements = sAchievementMgr->GetAchievementByReferencedId(criteria->AchievementID))
+        for (AchievementEntry const* sharingAchievement : *sharingAchievements)
+            if (!HasAchieved(sharingAchievement->ID))
+                return false;
+
+    return true;
+}
+
+void AchievementMgr::BuildOpenCriteriaIndex()
+{
+    m_closedCriteria.assign(sAchievementCriteriaStore.GetNumRows(), false);
+    m_openCriteriaCount.fill(0);
+
+    for (uint32 type = 0; type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++type)
+    {
+        for (AchievementCriteriaEntry const* criteria : sAchievementMgr->GetAchievementCriteriaByType(AchievementCriteriaTypes(type), 0))
+        {
+            if (IsCriteriaClosed(criteria))
+                m_closedCriteria[criteria->ID] = true;
+            else
+                ++m_openCriteriaCount[type];
+        }
+    }
+}
+
+void AchievementMgr::CloseCriteriaOf(uint32 achievementId)
+{
+    AchievementCriteriaEntryList const* criteriaList = sAchievementMgr->GetAchievementCriteriaByAchievement(achievementId);
+    if (!criteriaList)
+        return;
+
+    for (AchievementCriteriaEntry const* criteria : *criteriaList)
+    {
+        if (m_closedCriteria[criteria->ID] || !IsCriteriaClosed(criteria))
+            continue;
+
+        m_closedCriteria[criteria->ID] = true;
+        --m_openCriteriaCount[criteria->Type];
+    }
 }
 
 void AchievementMgr::SendAchievementEarned(AchievementEntry const* achievement) const
@@ -786,9 +838,18 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     TC_LOG_DEBUG("achievement", "UpdateAchievementCriteria: {}, {} ({}), {}, {}"
         , m_player->GetGUID().ToString(), AchievementGlobalMgr::GetCriteriaTypeString(type), type, miscValue1, miscValue2);
 
+    // everything of this type belongs to achievements already earned
+    if (!m_openCriteriaCount[type])
+        return;
+
+    TC_METRIC_DETAILED_TIMER("achievement_criteria_update_time", TC_METRIC_TAG("type", AchievementGlobalMgr::GetCriteriaTypeString(type)));
+
     AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type, miscValue1);
     for (AchievementCriteriaEntry const* achievementCriteria : achievementCriteriaList)
     {
+        if (m_closedCriteria[achievementCriteria->ID])
+            continue;
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->AchievementID);
         if (!CanUpdateCriteria(achievementCriteria, achievement, miscValue1, miscValue2, ref))
             continue;
@@ -1529,6 +1590,10 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
 
     m_achievementPoints += achievement->Points;
 
+    CloseCriteriaOf(achievement->ID);
+    if (achievement->SharesCriteria)
+        CloseCriteriaOf(achievement->SharesCriteria);
+
     UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_ACHIEVEMENT, achievement->ID);
     UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_EARN_ACHIEVEMENT_POINTS, achievement->Points);
 
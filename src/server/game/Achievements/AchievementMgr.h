@@ -23,6 +23,7 @@
 #include "DBCStores.h"
 #include "Duration.h"
 #include "ObjectGuid.h"
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -308,12 +309,19 @@ class TC_GAME_API AchievementMgr
         bool ConditionsSatisfied(AchievementCriteriaEntry const* criteria) const;
         bool RequirementsSatisfied(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint32 miscValue1, uint32 miscValue2, WorldObject const* ref) const;
 
+        // criteria of completed achievements that no unfinished achievement shares can never progress again
+        bool IsCriteriaClosed(AchievementCriteriaEntry const* criteria) const;
+        void BuildOpenCriteriaIndex();
+        void CloseCriteriaOf(uint32 achievementId);
+
         Player* m_player;
         CriteriaProgressMap m_criteriaProgress;
         CompletedAchievementMap m_completedAchievements;
         typedef std::map<uint32, uint32> TimedAchievementMap;
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
         uint32 m_achievementPoints;
+        std::vector<bool> m_closedCriteria;                                                     // indexed by criteria id
+        std::array<uint32, ACHIEVEMENT_CRITERIA_TYPE_TOTAL> m_openCriteriaCount;                // criteria not yet closed, by type
 };
 
 class TC_GAME_API AchievementGlobalMgr
@@ -109,7 +109,7 @@ bool ArenaTeam::AddMember(ObjectGuid playerGuid)
     }
     else
     {
-        CharacterCacheEntry const* cInfo = sCharacterCache->GetCharacterCacheByGuid(playerGuid);
+        Optional<CharacterCacheEntry> cInfo = sCharacterCache->GetCharacterCacheByGuid(playerGuid);
         if (!cInfo)
             return false;
 
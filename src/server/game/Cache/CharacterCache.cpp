@@ -22,14 +22,68 @@
 #include "MiscPackets.h"
 #include "Player.h"
 #include "Timer.h"
+#include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <array>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    // the cache is read from the world thread, map threads and query callbacks alike
+    // entries are spread over shards by guid and by name, each with its own reader/writer lock,
+    // so concurrent lookups never wait on each other and writers only block one shard
+    constexpr std::size_t CHARACTER_CACHE_SHARDS = 16;
+
+    struct CharacterCacheGuidShard
+    {
+        std::shared_mutex Lock;
+        std::unordered_map<ObjectGuid, CharacterCacheEntry> Entries;
+    };
+
+    struct CharacterCacheNameShard
+    {
+        std::shared_mutex Lock;
+        std::unordered_map<std::string, ObjectGuid> Entries;   // case folded name to guid
+    };
+
+    std::array<CharacterCacheGuidShard, CHARACTER_CACHE_SHARDS> _characterCacheStore;
+    std::array<CharacterCacheNameShard, CHARACTER_CACHE_SHARDS> _characterCacheByNameStore;
+
+    CharacterCacheGuidShard& GetGuidShard(ObjectGuid const& guid)
+    {
+        return _characterCacheStore[guid.GetCounter() % CHARACTER_CACHE_SHARDS];
+    }
+
+    CharacterCacheNameShard& GetNameShard(std::string const& foldedName)
+    {
+        return _characterCacheByNameStore[std::hash<std::string>()(foldedName) % CHARACTER_CACHE_SHARDS];
+    }
+
+    // calls reader with the entry of guid under a shared lock, returns defaultValue if there is none
+    template<typename T, typename Reader>
+    T ReadCharacterCacheEntry(ObjectGuid const& guid, T defaultValue, Reader&& reader)
+    {
+        CharacterCacheGuidShard& shard = GetGuidShard(guid);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock);
+        auto itr = shard.Entries.find(guid);
+        if (itr == shard.Entries.end())
+            return defaultValue;
+
+        return reader(itr->second);
+    }
+
+    // calls writer with the entry of guid under an exclusive lock, if there is one
+    template<typename Writer>
+    void WriteCharacterCacheEntry(ObjectGuid const& guid, Writer&& writer)
+    {
+        CharacterCacheGuidShard& shard = GetGuidShard(guid);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        auto itr = shard.Entries.find(guid);
+        if (itr != shard.Entries.end())
+            writer(itr->second);
+    }
 }
 
 CharacterCache::CharacterCache()
@@ -55,7 +109,7 @@ CharacterCache* CharacterCache::instance()
 * @return Name, Gender, Race, Class and Level of player character
 * Example Usage:
 * @code
-*    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
+*    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
 *    if (!characterInfo)
 *        return;
 *
@@ -69,7 +123,11 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
+    for (CharacterCacheGuidShard& shard : _characterCacheStore)
+        shard.Entries.clear();
+    for (CharacterCacheNameShard& shard : _characterCacheByNameStore)
+        shard.Entries.clear();
+
     uint32 oldMSTime = getMSTime();
 
     QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
@@ -79,14 +137,58 @@ void CharacterCache::LoadCharacterCacheStorage()
         return;
     }
 
+    // size every shard once for its share of the characters instead of letting them rehash while filling up
+    std::size_t shardSize = result->GetRowCount() / CHARACTER_CACHE_SHARDS + 1;
+    for (CharacterCacheGuidShard& shard : _characterCacheStore)
+        shard.Entries.reserve(shardSize);
+    for (CharacterCacheNameShard& shard : _characterCacheByNameStore)
+        shard.Entries.reserve(shardSize);
+
+    // nothing else can access the cache yet, fill the shards directly
+    uint32 count = 0;
     do
     {
         Field* fields = result->Fetch();
-        AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32()) /*guid*/, fields[2].GetUInt32() /*account*/, fields[1].GetString() /*name*/,
-            fields[4].GetUInt8() /*gender*/, fields[3].GetUInt8() /*race*/, fields[5].GetUInt8() /*class*/, fields[6].GetUInt8() /*level*/);
+        ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32());
+
+        CharacterCacheEntry& data = GetGuidShard(guid).Entries[guid];
+        data.Guid = guid;
+        data.Name = fields[1].GetString();
+        data.AccountId = fields[2].GetUInt32();
+        data.Race = fields[3].GetUInt8();
+        data.Sex = fields[4].GetUInt8();
+        data.Class = fields[5].GetUInt8();
+        data.Level = fields[6].GetUInt8();
+        data.GuildId = 0;                           // Will be set in guild loading or guild setting
+        for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+            data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
+
+        std::string foldedName = FoldName(data.Name);
+        GetNameShard(foldedName).Entries[std::move(foldedName)] = guid;
+        ++count;
     } while (result->NextRow());
 
-    TC_LOG_INFO("server.loading", "Loaded character infos for {} characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    TC_LOG_INFO("server.loading", "Loaded character infos for {} characters in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+}
+
+std::string CharacterCache::FoldName(std::string_view name)
+{
+    std::string folded(name);
+
+    // names are mostly plain latin, skip the conversion to wide characters for those
+    if (std::all_of(folded.begin(), folded.end(), [](char c) { return !(c & 0x80); }))
+    {
+        std::transform(folded.begin(), folded.end(), folded.begin(), charToLower);
+        return folded;
+    }
+
+    std::wstring wname;
+    if (!Utf8toWStr(name, wname))
+        return folded;
+
+    wstrToLower(wname);
+    WStrToUtf8(wname, folded);
+    return folded;
 }
 
 /*
@@ -94,86 +196,101 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
-    data.AccountId = accountId;
-    data.Race = race;
-    data.Sex = gender;
-    data.Class = playerClass;
-    data.Level = level;
-    data.GuildId = 0;                           // Will be set in guild loading or guild setting
-    for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
-        data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
+    {
+        CharacterCacheGuidShard& shard = GetGuidShard(guid);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+
+        CharacterCacheEntry& data = shard.Entries[guid];
+        data.Guid = guid;
+        data.Name = name;
+        data.AccountId = accountId;
+        data.Race = race;
+        data.Sex = gender;
+        data.Class = playerClass;
+        data.Level = level;
+        data.GuildId = 0;                           // Will be set in guild loading or guild setting
+        for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+            data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
+    }
 
     // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    std::string foldedName = FoldName(name);
+    CharacterCacheNameShard& shard = GetNameShard(foldedName);
+    std::unique_lock<std::shared_mutex> lock(shard.Lock);
+    shard.Entries[std::move(foldedName)] = guid;
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    {
+        CharacterCacheGuidShard& shard = GetGuidShard(guid);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Entries.erase(guid);
+    }
+
+    std::string foldedName = FoldName(name);
+    CharacterCacheNameShard& shard = GetNameShard(foldedName);
+    std::unique_lock<std::shared_mutex> lock(shard.Lock);
+    shard.Entries.erase(foldedName);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
+    std::string oldName;
+    bool found = false;
+    WriteCharacterCacheEntry(guid, [&](CharacterCacheEntry& data)
+    {
+        oldName = std::move(data.Name);
+        data.Name = name;
+
+        if (gender)
+            data.Sex = *gender;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+        if (race)
+            data.Race = *race;
 
-    if (gender)
-        itr->second.Sex = *gender;
+        found = true;
+    });
 
-    if (race)
-        itr->second.Race = *race;
+    if (!found)
+        return;
 
     WorldPackets::Misc::InvalidatePlayer packet(guid);
     sWorld->SendGlobalMessage(packet.Write());
 
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    // Correct name -> guid storage
+    {
+        std::string foldedName = FoldName(oldName);
+        CharacterCacheNameShard& shard = GetNameShard(foldedName);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Entries.erase(foldedName);
+    }
+
+    std::string foldedName = FoldName(name);
+    CharacterCacheNameShard& shard = GetNameShard(foldedName);
+    std::unique_lock<std::shared_mutex> lock(shard.Lock);
+    shard.Entries[std::move(foldedName)] = guid;
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.Level = level;
+    WriteCharacterCacheEntry(guid, [level](CharacterCacheEntry& data) { data.Level = level; });
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.AccountId = accountId;
+    WriteCharacterCacheEntry(guid, [accountId](CharacterCacheEntry& data) { data.AccountId = accountId; });
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.GuildId = guildId;
+    WriteCharacterCacheEntry(guid, [guildId](CharacterCacheEntry& data) { data.GuildId = guildId; });
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
     ASSERT(slot < 3);
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    WriteCharacterCacheEntry(guid, [slot, arenaTeamId](CharacterCacheEntry& data) { data.ArenaTeamId[slot] = arenaTeamId; });
 }
 
 /*
@@ -181,98 +298,76 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return ReadCharacterCacheEntry(guid, false, [](CharacterCacheEntry const&) { return true; });
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-        return &itr->second;
-
-    return nullptr;
+    return ReadCharacterCacheEntry(guid, Optional<CharacterCacheEntry>(), [](CharacterCacheEntry const& data) { return Optional<CharacterCacheEntry>(data); });
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second;
+    ObjectGuid guid = GetCharacterGuidByName(name);
+    if (guid.IsEmpty())
+        return {};
 
-    return nullptr;
+    return GetCharacterCacheByGuid(guid);
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->Guid;
+    std::string foldedName = FoldName(name);
+    CharacterCacheNameShard& shard = GetNameShard(foldedName);
+    std::shared_lock<std::shared_mutex> lock(shard.Lock);
+    auto itr = shard.Entries.find(foldedName);
+    if (itr != shard.Entries.end())
+        return itr->second;
 
     return ObjectGuid::Empty;
 }
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return false;
-
-    name = itr->second.Name;
-    return true;
+    return ReadCharacterCacheEntry(guid, false, [&name](CharacterCacheEntry const& data)
+    {
+        name = data.Name;
+        return true;
+    });
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return 0;
-
-    return Player::TeamForRace(itr->second.Race);
+    return ReadCharacterCacheEntry(guid, 0u, [](CharacterCacheEntry const& data) { return Player::TeamForRace(data.Race); });
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return 0;
-
-    return itr->second.AccountId;
+    return ReadCharacterCacheEntry(guid, 0u, [](CharacterCacheEntry const& data) { return data.AccountId; });
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->AccountId;
+    ObjectGuid guid = GetCharacterGuidByName(name);
+    if (guid.IsEmpty())
+        return 0;
 
-    return 0;
+    return GetCharacterAccountIdByGuid(guid);
 }
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return 0;
-
-    return itr->second.Level;
+    return ReadCharacterCacheEntry(guid, uint8(0), [](CharacterCacheEntry const& data) { return data.Level; });
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return 0;
-
-    return itr->second.GuildId;
+    return ReadCharacterCacheEntry(guid, ObjectGuid::LowType(0), [](CharacterCacheEntry const& data) { return data.GuildId; });
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return 0;
-
     uint8 slot = ArenaTeam::GetSlotByType(type);
     ASSERT(slot < 3);
-    return itr->second.ArenaTeamId[slot];
+    return ReadCharacterCacheEntry(guid, 0u, [slot](CharacterCacheEntry const& data) { return data.ArenaTeamId[slot]; });
 }
@@ -22,6 +22,7 @@
 #include "ObjectGuid.h"
 #include "Optional.h"
 #include <string>
+#include <string_view>
 
 struct CharacterCacheEntry
 {
@@ -44,6 +45,9 @@ class TC_GAME_API CharacterCache
         static CharacterCache* instance();
 
         void LoadCharacterCacheStorage();
+
+        // lookups by name are case insensitive, this is the key they use
+        static std::string FoldName(std::string_view name);
         void AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level);
         void DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name);
 
@@ -53,9 +57,10 @@ class TC_GAME_API CharacterCache
         void UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId);
         void UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId);
 
+        // safe to call from any thread, entries are copied under the lock since other threads may update them at any time
         bool HasCharacterCacheEntry(ObjectGuid const& guid) const;
-        CharacterCacheEntry const* GetCharacterCacheByGuid(ObjectGuid const& guid) const;
-        CharacterCacheEntry const* GetCharacterCacheByName(std::string const& name) const;
+        Optional<CharacterCacheEntry> GetCharacterCacheByGuid(ObjectGuid const& guid) const;
+        Optional<CharacterCacheEntry> GetCharacterCacheByName(std::string const& name) const;
 
         ObjectGuid GetCharacterGuidByName(std::string const& name) const;
         bool GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const;
@@ -187,7 +187,7 @@ struct ChannelOwnerAppend
 {
     explicit ChannelOwnerAppend(Channel const* channel, ObjectGuid const& ownerGuid) : _channel(channel), _ownerGuid(ownerGuid)
     {
-        if (CharacterCacheEntry const* cInfo = sCharacterCache->GetCharacterCacheByGuid(_ownerGuid))
+        if (Optional<CharacterCacheEntry> cInfo = sCharacterCache->GetCharacterCacheByGuid(_ownerGuid))
             _ownerName = cInfo->Name;
     }
 
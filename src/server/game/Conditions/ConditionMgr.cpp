@@ -834,48 +834,57 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionContainer cons
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> elseGroupStore;
-    for (Condition const* condition : conditions)
+    // ElseGroups are or'ed, conditions sharing an ElseGroup are and'ed
+    // groups are checked in order of first appearance, the first matching group ends the check
+    for (std::size_t i = 0; i < conditions.size(); ++i)
     {
+        uint32 elseGroup = conditions[i]->ElseGroup;
+
+        // group already checked, containers owned by ConditionMgr keep their groups contiguous
+        if (i && conditions[i - 1]->ElseGroup == elseGroup)
+            continue;
+
+        if (std::any_of(conditions.begin(), conditions.begin() + i, [elseGroup](Condition const* condition) { return condition->ElseGroup == elseGroup; }))
+            continue;
+
+        if (IsObjectMeetToConditionGroup(sourceInfo, conditions, i))
+            return true;
+    }
+
+    return false;
+}
+
+bool ConditionMgr::IsObjectMeetToConditionGroup(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions, std::size_t first) const
+{
+    uint32 elseGroup = conditions[first]->ElseGroup;
+    bool hasLoadedCondition = false;
+    for (std::size_t i = first; i < conditions.size(); ++i)
+    {
+        Condition const* condition = conditions[i];
+        if (condition->ElseGroup != elseGroup || !condition->isLoaded())
+            continue;
+
         TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} val1: {}", condition->ToString(), condition->ConditionValue1);
-        if (condition->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = elseGroupStore.find(condition->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == elseGroupStore.end())
-                elseGroupStore[condition->ElseGroup] = true;
-            else if (!(*itr).second) //! If another condition in this group was unmatched before this, don't bother checking (the group is false anyway)
-                continue;
+        hasLoadedCondition = true;
 
-            if (condition->ReferenceId)//handle reference
+        if (condition->ReferenceId)//handle reference
+        {
+            if (condition->ReferencedConditions)
             {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, ref->second))
-                        elseGroupStore[condition->ElseGroup] = false;
-                }
-                else
-                {
-                    TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
-                        condition->ToString(), condition->ReferenceId); // checked at loading, should never happen
-                }
-
+                if (!IsObjectMeetToConditionList(sourceInfo, *condition->ReferencedConditions))
+                    return false;
             }
-            else //handle normal condition
+            else
             {
-                if (!condition->Meets(sourceInfo))
-                    elseGroupStore[condition->ElseGroup] = false;
+                TC_LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList {} Reference template -{} not found",
+                    condition->ToString(), condition->ReferenceId); // checked at loading, should never happen
             }
         }
+        else if (!condition->Meets(sourceInfo))//handle normal condition
+            return false;
     }
-    for (std::map<uint32, bool>::const_iterator i = elseGroupStore.begin(); i != elseGroupStore.end(); ++i)
-        if (i->second)
-            return true;
 
-    return false;
+    return hasLoadedCondition;
 }
 
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionContainer const& conditions) const
@@ -1299,9 +1308,61 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
     while (result->NextRow());
 
+    CompileConditions();
+
     TC_LOG_INFO("server.loading", ">> Loaded {} conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
+// No constant folding is done here: CONDITION_NONE rows are rejected by isConditionTypeValid, so every stored
+// condition is either a reference or a type reading live state (or a script), and no list is trivially true or false
+void ConditionMgr::CompileConditions()
+{
+    auto resolveReference = [this](Condition* condition)
+    {
+        if (!condition->ReferenceId)
+            return;
+
+        ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
+        if (ref != ConditionReferenceStore.end())
+            condition->ReferencedConditions = &ref->second;
+    };
+
+    // keep else groups contiguous so IsObjectMeetToConditionList checks each group in a single run
+    auto compile = [&](ConditionContainer& conditions)
+    {
+        std::stable_sort(conditions.begin(), conditions.end(), [](Condition const* left, Condition const* right)
+        {
+            return left->ElseGroup < right->ElseGroup;
+        });
+
+        for (Condition* condition : conditions)
+            resolveReference(condition);
+    };
+
+    auto compileByEntry = [&](ConditionsByEntryMap& conditionsByEntry)
+    {
+        for (std::pair<uint32 const, ConditionContainer>& conditions : conditionsByEntry)
+            compile(conditions.second);
+    };
+
+    for (std::pair<uint32 const, ConditionContainer>& conditions : ConditionReferenceStore)
+        compile(conditions.second);
+
+    for (ConditionsByEntryMap& conditionsByEntry : ConditionStore)
+        compileByEntry(conditionsByEntry);
+
+    for (ConditionEntriesByCreatureIdMap* store : { &VehicleSpellConditionStore, &SpellClickEventConditionStore, &NpcVendorConditionContainerStore })
+        for (std::pair<uint32 const, ConditionsByEntryMap>& conditionsByEntry : *store)
+            compileByEntry(conditionsByEntry.second);
+
+    for (std::pair<std::pair<int32, uint32> const, ConditionsByEntryMap>& conditionsByEntry : SmartEventConditionStore)
+        compileByEntry(conditionsByEntry.second);
+
+    // grouped conditions stored in loot templates, gossip menus and spells
+    for (Condition* condition : AllocatedMemoryStore)
+        resolveReference(condition);
+}
+
 bool ConditionMgr::addToLootTemplate(Condition* cond, LootTemplate* loot) const
 {
     if (!loot)
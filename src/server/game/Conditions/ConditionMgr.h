@@ -215,6 +215,7 @@ struct TC_GAME_API Condition
     uint32                  ScriptId;
     uint8                   ConditionTarget;
     bool                    NegativeCondition;
+    std::vector<Condition*> const* ReferencedConditions; // resolved ReferenceId, set once all conditions are loaded
 
     Condition()
     {
@@ -233,6 +234,7 @@ struct TC_GAME_API Condition
         ErrorTextId        = 0;
         ScriptId           = 0;
         NegativeCondition  = false;
+        ReferencedConditions = nullptr;
     }
 
     bool Meets(ConditionSourceInfo& sourceInfo) const;
@@ -296,6 +298,8 @@ class TC_GAME_API ConditionMgr
         bool addToGossipMenuItems(Condition* cond) const;
         bool addToSpellImplicitTargetConditions(Condition* cond) const;
         bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
+        bool IsObjectMeetToConditionGroup(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions, std::size_t first) const;
+        void CompileConditions();
 
         static void LogUselessConditionValue(Condition* cond, uint8 index, uint32 value);
 
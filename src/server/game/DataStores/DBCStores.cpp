@@ -26,7 +26,10 @@
 #include "Regex.h"
 #include "SharedDefines.h"
 #include "SpellMgr.h"
+#include "ThreadPool.h"
 #include "Timer.h"
+#include <atomic>
+#include <mutex>
 
 // temporary hack until includes are sorted out (don't want to pull in Windows.h)
 #ifdef GetClassName
@@ -217,7 +220,33 @@ DBCStorage <WorldSafeLocsEntry> sWorldSafeLocsStore(WorldSafeLocsEntryfmt);
 
 typedef std::list<std::string> StoreProblemList;
 
-uint32 DBCFileCount = 0;
+// Shared by all stores while they are loaded concurrently
+struct DBCLoadState
+{
+    std::atomic<uint32> FileCount{ 0 };
+    std::atomic<uint32> AvailableLocales{ 0xFFFFFFFF };
+
+    std::mutex Lock;
+    StoreProblemList Errors;
+    std::string SlowestFile;
+    uint32 SlowestTime = 0;
+
+    void AddError(std::string error)
+    {
+        std::lock_guard<std::mutex> lock(Lock);
+        Errors.push_back(std::move(error));
+    }
+
+    void AddLoadTime(std::string const& filename, uint32 loadTime)
+    {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (loadTime >= SlowestTime)
+        {
+            SlowestTime = loadTime;
+            SlowestFile = filename;
+        }
+    }
+};
 
 static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string& filename)
 {
@@ -228,20 +257,22 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
 }
 
 template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename,
+inline void LoadDBC(DBCLoadState& state, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename,
                     char const* dbTable = nullptr, char const* dbFormat = nullptr, char const* dbIndexName = nullptr)
 {
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DBCFileCount;
+    uint32 oldMSTime = getMSTime();
+
+    ++state.FileCount;
     std::string dbcFilename = dbcPath + filename;
 
     if (storage.Load(dbcFilename.c_str()))
     {
         for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
         {
-            if (!(availableDbcLocales & (1 << i)))
+            if (!(state.AvailableLocales & (1 << i)))
                 continue;
 
             std::string localizedName(dbcPath);
@@ -250,7 +281,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
             localizedName.append(filename);
 
             if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1 << i);             // mark as not available for speedup next checks
+                state.AvailableLocales &= ~(1 << i);          // mark as not available for speedup next checks
         }
 
         if (dbTable)
@@ -263,13 +294,14 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
         {
             std::ostringstream stream;
             stream << dbcFilename << " exists, and has " << storage.GetFieldCount() << " field(s) (expected " << strlen(storage.GetFormat()) << "). Extracted file might be from wrong client version or a database-update has been forgotten. Search on forum for TCE00008 for more info.";
-            std::string buf = stream.str();
-            errors.push_back(buf);
+            state.AddError(stream.str());
             fclose(f);
         }
         else
-            errors.push_back(dbcFilename);
+            state.AddError(dbcFilename);
     }
+
+    state.AddLoadTime(filename, GetMSTimeDiffToNow(oldMSTime));
 }
 
 void LoadDBCStores(const std::string& dataPath)
@@ -278,10 +310,12 @@ void LoadDBCStores(const std::string& dataPath)
 
     std::string dbcPath = dataPath + "dbc/";
 
-    StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
+    DBCLoadState state;
+
+    // Every store is independent until the post processing below, load them all concurrently
+    Trinity::ThreadPool pool;
 
-#define LOAD_DBC(store, file) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file)
+#define LOAD_DBC(store, file) pool.PostWork([&]() { LoadDBC(state, store, dbcPath, file); })
 
     LOAD_DBC(sAreaTableStore,                     "AreaTable.dbc");
     LOAD_DBC(sAchievementCriteriaStore,           "Achievement_Criteria.dbc");
@@ -400,7 +434,7 @@ void LoadDBCStores(const std::string& dataPath)
 
 #undef LOAD_DBC
 
-#define LOAD_DBC_EXT(store, file, dbtable, dbformat, dbpk) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable, dbformat, dbpk)
+#define LOAD_DBC_EXT(store, file, dbtable, dbformat, dbpk) pool.PostWork([&]() { LoadDBC(state, store, dbcPath, file, dbtable, dbformat, dbpk); })
 
     LOAD_DBC_EXT(sAchievementStore,     "Achievement.dbc",      "achievement_dbc",      CustomAchievementfmt,     CustomAchievementIndex);
     LOAD_DBC_EXT(sSpellStore,           "Spell.dbc",            "spell_dbc",            CustomSpellEntryfmt,      CustomSpellEntryIndex);
@@ -408,6 +442,12 @@ void LoadDBCStores(const std::string& dataPath)
 
 #undef LOAD_DBC_EXT
 
+    pool.Join();
+
+    uint32 loadTime = GetMSTimeDiffToNow(oldMSTime);
+    StoreProblemList& bad_dbc_files = state.Errors;
+    uint32 const DBCFileCount = state.FileCount;
+
     for (CharacterFacialHairStylesEntry const* entry : sCharacterFacialHairStylesStore)
         if (entry->RaceID && ((1 << (entry->RaceID - 1)) & RACEMASK_ALL_PLAYABLE) != 0) // ignore nonplayable races
             sCharFacialHairMap.insert({ entry->RaceID | (entry->SexID << 8) | (entry->VariationID << 16), entry });
@@ -669,7 +709,8 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    TC_LOG_INFO("server.loading", ">> Initialized {} data stores in {} ms", DBCFileCount, GetMSTimeDiffToNow(oldMSTime));
+    TC_LOG_INFO("server.loading", ">> Initialized {} data stores in {} ms (loaded in {} ms, slowest store {} took {} ms)", DBCFileCount, GetMSTimeDiffToNow(oldMSTime),
+        loadTime, state.SlowestFile, state.SlowestTime);
 
 }
 
@@ -248,6 +248,13 @@ Player::Player(WorldSession* session): Unit(true)
     m_DailyQuestChanged = false;
     m_lastDailyQuestTime = 0;
 
+    // state is unknown until the first save of the session
+    m_bgDataChanges = 1;
+    m_glyphsChanges = 1;
+    m_savedSections = { 0, 0, true };
+    m_writtenSections = m_savedSections;
+    m_saveSequence = 0;
+
     // Init rune flags
     for (uint8 i = 0; i < MAX_RUNES; ++i)
     {
@@ -1206,8 +1213,8 @@ void Player::Update(uint32 p_time)
     {
         if (p_time >= m_nextSave)
         {
-            // m_nextSave reset in SaveToDB call
-            SaveToDB();
+            // m_nextSave reset in SaveToDB call, committed together with the other players of the map
+            GetMap()->SavePlayerInBatch(this);
             TC_LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
         }
         else
@@ -1853,6 +1860,7 @@ void Player::ProcessDelayedOperations()
         {
             CastSpell(this, m_bgData.mountSpell, true);
             m_bgData.mountSpell = 0;
+            ++m_bgDataChanges;
         }
     }
 
@@ -1863,6 +1871,7 @@ void Player::ProcessDelayedOperations()
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[0]);
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[1]);
             m_bgData.ClearTaxiPath();
+            ++m_bgDataChanges;
 
             ContinueTaxiFlight();
         }
@@ -3972,7 +3981,7 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
     // Convert guid to low GUID for CharacterNameData, but also other methods on success
     ObjectGuid::LowType guid = playerguid.GetCounter();
     uint32 charDelete_method = sWorld->getIntConfig(CONFIG_CHARDELETE_METHOD);
-    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(playerguid);
+    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(playerguid);
     std::string name;
     if (characterInfo)
         name = characterInfo->Name;
@@ -17372,6 +17381,7 @@ bool Player::LoadFromDB(ObjectGuid guid, CharacterDatabaseQueryHolder const& hol
 
             // We are not in BG anymore
             m_bgData.bgInstanceID = 0;
+            ++m_bgDataChanges;
         }
     }
     // currently we do not support transport in bg
@@ -19241,6 +19251,10 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create /* = false
         return;
     }
 
+    // sections skipped while unchanged count as saved only once ConfirmSave gets this sequence
+    ++m_saveSequence;
+    m_writtenSections = m_savedSections;
+
     // first save/honor gain after midnight will also update the player's honor fields
     UpdateHonorFields();
 
@@ -19609,8 +19623,25 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
     }
 }
 
+void Player::ConfirmSave(uint32 saveSequence)
+{
+    // a later save may still be in flight with newer data
+    if (saveSequence != m_saveSequence)
+        return;
+
+    m_savedSections = m_writtenSections;
+}
+
 void Player::_SaveAuras(CharacterDatabaseTransaction trans)
 {
+    bool hasAurasToSave = std::any_of(m_ownedAuras.begin(), m_ownedAuras.end(), [](AuraMap::value_type const& pair) { return pair.second->CanBeSaved(); });
+
+    // nothing stored and nothing to store, skip the delete too
+    if (!hasAurasToSave && !m_savedSections.HasAuras)
+        return;
+
+    m_writtenSections.HasAuras = hasAurasToSave;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
     stmt->setUInt32(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -21213,7 +21244,7 @@ void Player::RemovePetitionsAndSigns(ObjectGuid guid, CharterTypes type)
 
 void Player::LeaveAllArenaTeams(ObjectGuid guid)
 {
-    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(guid);
+    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(guid);
     if (!characterInfo)
         return;
 
@@ -22194,11 +22225,14 @@ void Player::SetBattlegroundEntryPoint()
 
     if (m_bgData.joinPos.m_mapId == MAPID_INVALID) // In error cases use homebind position
         m_bgData.joinPos = WorldLocation(m_homebindMapId, m_homebindX, m_homebindY, m_homebindZ, 0.0f);
+
+    ++m_bgDataChanges;
 }
 
 void Player::SetBGTeam(uint32 team)
 {
     m_bgData.bgTeam = team;
+    ++m_bgDataChanges;
     SetArenaFaction(uint8(team == ALLIANCE ? 1 : 0));
 }
 
@@ -23340,6 +23374,7 @@ void Player::SetBattlegroundId(uint32 val, BattlegroundTypeId bgTypeId)
 {
     m_bgData.bgInstanceID = val;
     m_bgData.bgTypeID = bgTypeId;
+    ++m_bgDataChanges;
 }
 
 uint32 Player::AddBattlegroundQueueId(BattlegroundQueueTypeId val)
@@ -24527,6 +24562,7 @@ void Player::InitGlyphsForLevel()
 void Player::SetGlyph(uint8 slot, uint32 glyph)
 {
     _talentMgr->SpecInfo[GetActiveSpec()].Glyphs[slot] = glyph;
+    ++m_glyphsChanges;
     SetUInt32Value(PLAYER_FIELD_GLYPHS_1 + slot, glyph);
 }
 
@@ -25824,6 +25860,11 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction trans)
 
 void Player::_SaveBGData(CharacterDatabaseTransaction trans)
 {
+    if (m_bgDataChanges == m_savedSections.BGDataChanges)
+        return;
+
+    m_writtenSections.BGDataChanges = m_bgDataChanges;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_BGDATA);
     stmt->setUInt32(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -25912,8 +25953,13 @@ void Player::_LoadGlyphs(PreparedQueryResult result)
     while (result->NextRow());
 }
 
-void Player::_SaveGlyphs(CharacterDatabaseTransaction trans) const
+void Player::_SaveGlyphs(CharacterDatabaseTransaction trans)
 {
+    if (m_glyphsChanges == m_savedSections.GlyphsChanges)
+        return;
+
+    m_writtenSections.GlyphsChanges = m_glyphsChanges;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_GLYPHS);
     stmt->setUInt32(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -26028,6 +26074,7 @@ void Player::UpdateSpecCount(uint8 count)
     CharacterDatabase.CommitTransaction(trans);
 
     SetSpecsCount(count);
+    ++m_glyphsChanges;
 
     SendTalentsInfoData(false);
 }
@@ -1377,6 +1377,8 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
 
         void SaveToDB(bool create = false);
         void SaveToDB(CharacterDatabaseTransaction trans, bool create = false);
+        uint32 GetSaveSequence() const { return m_saveSequence; }
+        void ConfirmSave(uint32 saveSequence);              // the transaction of that SaveToDB was committed
         void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
         void SaveGoldToDB(CharacterDatabaseTransaction trans) const;
 
@@ -2334,7 +2336,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void _SaveSpells(CharacterDatabaseTransaction trans);
         void _SaveEquipmentSets(CharacterDatabaseTransaction trans);
         void _SaveBGData(CharacterDatabaseTransaction trans);
-        void _SaveGlyphs(CharacterDatabaseTransaction trans) const;
+        void _SaveGlyphs(CharacterDatabaseTransaction trans);
         void _SaveTalents(CharacterDatabaseTransaction trans);
         void _SaveStats(CharacterDatabaseTransaction trans) const;
 
@@ -2424,6 +2426,19 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         bool   m_SeasonalQuestChanged;
         time_t m_lastDailyQuestTime;
 
+        // BG data, glyphs and auras are only rewritten when they differ from the last committed save
+        struct SaveSections
+        {
+            uint32 BGDataChanges;
+            uint32 GlyphsChanges;
+            bool HasAuras;                                  // at least one aura row is stored
+        };
+        uint32 m_bgDataChanges;                             // bumped on every change of m_bgData
+        uint32 m_glyphsChanges;
+        SaveSections m_savedSections;                       // as of the last confirmed save
+        SaveSections m_writtenSections;                     // as written by the last SaveToDB
+        uint32 m_saveSequence;
+
         uint32 m_hostileReferenceCheckTimer;
         uint32 m_drunkTimer;
         uint32 m_weaponChangeTimer;
@@ -343,7 +343,8 @@ Unit::Unit(bool isWorldObject) :
     for (uint8 i = 0; i < MAX_GAMEOBJECT_SLOT; ++i)
         m_ObjectSlot[i].Clear();
 
-    m_auraUpdateIterator = m_ownedAuras.end();
+    m_idleAuraUpdateTimer = 0;
+    m_auraUpdateListsDirty = false;
 
     m_interruptMask = 0;
     m_canModifyStats = false;
@@ -2868,14 +2869,41 @@ void Unit::_UpdateSpells(uint32 time)
         }
     }
 
-    // m_auraUpdateIterator can be updated in indirect called code at aura remove to skip next planned to update but removed auras
-    for (m_auraUpdateIterator = m_ownedAuras.begin(); m_auraUpdateIterator != m_ownedAuras.end();)
+    // idle auras only refresh their target map, which is due every UPDATE_TARGET_MAP_INTERVAL anyway
+    m_idleAuraUpdateTimer += time;
+    bool const updateIdleAuras = m_idleAuraUpdateTimer >= UPDATE_TARGET_MAP_INTERVAL;
+
+    // auras are only added or removed through _AddAura/RemoveOwnedAura, which invalidate the lists,
+    // resorting on each idle update also catches auras that stopped ticking
+    if (m_auraUpdateListsDirty || updateIdleAuras)
+    {
+        m_tickingAuras.clear();
+        m_idleAuras.clear();
+        for (auto const& [spellId, aura] : m_ownedAuras)
+            (aura->IsIdleForUpdate() ? m_idleAuras : m_tickingAuras).push_back(aura);
+
+        m_auraUpdateListsDirty = false;
+    }
+
+    // auras removed during the update stay allocated until _DeleteRemovedAuras below
+    for (Aura* aura : m_tickingAuras)
+        if (!aura->IsRemoved())
+            aura->UpdateOwner(time, this);
+
+    std::size_t idleAuraUpdates = 0;
+    if (updateIdleAuras)
     {
-        Aura* i_aura = m_auraUpdateIterator->second;
-        ++m_auraUpdateIterator;                            // need shift to next for allow update if need into aura update
-        i_aura->UpdateOwner(time, this);
+        for (Aura* aura : m_idleAuras)
+            if (!aura->IsRemoved())
+                aura->UpdateOwner(m_idleAuraUpdateTimer, this);
+
+        idleAuraUpdates = m_idleAuras.size();
+        m_idleAuraUpdateTimer = 0;
     }
 
+    if (IsInWorld())
+        GetMap()->AddAuraUpdates(m_tickingAuras.size(), idleAuraUpdates);
+
     // remove expired auras - do that after updates(used in scripts?)
     for (AuraMap::iterator i = m_ownedAuras.begin(); i != m_ownedAuras.end();)
     {
@@ -3290,6 +3318,7 @@ void Unit::_AddAura(UnitAura* aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
     m_ownedAuras.emplace(aura->GetId(), aura);
+    m_auraUpdateListsDirty = true;
 
     _RemoveNoStackAurasDueToAura(aura, true);
 
@@ -3573,11 +3602,9 @@ void Unit::RemoveOwnedAura(AuraMap::iterator& i, AuraRemoveMode removeMode)
     Aura* aura = i->second;
     ASSERT(!aura->IsRemoved());
 
-    // if unit currently update aura list then make safe update iterator shift to next
-    if (m_auraUpdateIterator == i)
-        ++m_auraUpdateIterator;
-
+    // the update lists keep the pointer until they are rebuilt, the aura is skipped there as removed
     m_ownedAuras.erase(i);
+    m_auraUpdateListsDirty = true;
     m_removedAuras.push_back(aura);
 
     // Unregister single target aura
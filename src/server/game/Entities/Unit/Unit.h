@@ -1327,6 +1327,7 @@ class TC_GAME_API Unit : public WorldObject
         // m_ownedAuras container management
         AuraMap      & GetOwnedAuras()       { return m_ownedAuras; }
         AuraMap const& GetOwnedAuras() const { return m_ownedAuras; }
+        void _MarkAuraUpdateListsDirty() { m_auraUpdateListsDirty = true; }
 
         void RemoveOwnedAura(AuraMap::iterator& i, AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT);
         void RemoveOwnedAura(uint32 spellId, ObjectGuid casterGUID = ObjectGuid::Empty, uint8 reqEffMask = 0, AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT);
@@ -1662,6 +1663,7 @@ class TC_GAME_API Unit : public WorldObject
 
         void FollowerAdded(AbstractFollower* f) { m_followingMe.insert(f); }
         void FollowerRemoved(AbstractFollower* f) { m_followingMe.erase(f); }
+        std::unordered_set<AbstractFollower*> const& GetFollowers() const { return m_followingMe; }
         void RemoveAllFollowers();
 
         MotionMaster* GetMotionMaster() { return i_motionMaster; }
@@ -1866,9 +1868,14 @@ class TC_GAME_API Unit : public WorldObject
         AuraMap m_ownedAuras;
         AuraApplicationMap m_appliedAuras;
         AuraList m_removedAuras;
-        AuraMap::iterator m_auraUpdateIterator;
         uint32 m_removedAurasCount;
 
+        // m_ownedAuras split by Aura::IsIdleForUpdate, idle ones are updated together every UPDATE_TARGET_MAP_INTERVAL
+        std::vector<Aura*> m_tickingAuras;
+        std::vector<Aura*> m_idleAuras;
+        uint32 m_idleAuraUpdateTimer;
+        bool m_auraUpdateListsDirty;
+
         AuraEffectList m_modAuras[TOTAL_AURAS];
         AuraList m_scAuras;                        // cast singlecast auras
         AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
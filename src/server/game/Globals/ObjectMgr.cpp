@@ -2414,7 +2414,7 @@ ObjectGuid::LowType ObjectMgr::AddGameObjectData(uint32 entry, uint32 mapId, Pos
 
     // Spawn if necessary (loaded grids only)
     // We use spawn coords to spawn
-    if (!map->Instanceable() && map->IsGridLoaded(data.spawnPoint))
+    if (!map->Instanceable() && map->IsCellLoaded(data.spawnPoint))
     {
         GameObject* go = new GameObject;
         if (!go->LoadFromDB(spawnId, map, true))
@@ -2466,8 +2466,9 @@ ObjectGuid::LowType ObjectMgr::AddCreatureData(uint32 entry, uint32 mapId, Posit
 
     AddCreatureToGrid(spawnId, &data);
 
+    // Spawn if necessary (loaded grids and cells only), otherwise the grid loader creates it
     // We use spawn coords to spawn
-    if (!map->Instanceable() && !map->IsRemovalGrid(data.spawnPoint))
+    if (!map->Instanceable() && map->IsCellLoaded(data.spawnPoint))
     {
         Creature* creature = new Creature();
         if (!creature->LoadFromDB(spawnId, map, true, true))
@@ -25,6 +25,7 @@
 #include "GridReference.h"
 #include "Timer.h"
 #include "Util.h"
+#include <bitset>
 
 #define DEFAULT_VISIBILITY_NOTIFY_PERIOD      1000
 
@@ -103,6 +104,10 @@ class NGrid
         bool isGridObjectDataLoaded() const { return i_GridObjectDataLoaded; }
         void setGridObjectDataLoaded(bool pLoaded) { i_GridObjectDataLoaded = pLoaded; }
 
+        // cells whose creature and gameobject spawns were created, only a part of the grid when cells are loaded on demand
+        bool isCellObjectDataLoaded(uint32 x, uint32 y) const { return i_cellObjectDataLoaded[x * N + y]; }
+        void setCellObjectDataLoaded(uint32 x, uint32 y) { i_cellObjectDataLoaded[x * N + y] = true; }
+
         GridInfo* getGridInfoRef() { return &i_GridInfo; }
         TimeTracker const& getTimeTracker() const { return i_GridInfo.getTimeTracker(); }
         bool getUnloadLock() const { return i_GridInfo.getUnloadLock(); }
@@ -183,5 +188,6 @@ class NGrid
         grid_state_t i_cellstate;
         GridType i_cells[N][N];
         bool i_GridObjectDataLoaded;
+        std::bitset<N * N> i_cellObjectDataLoaded;
 };
 #endif
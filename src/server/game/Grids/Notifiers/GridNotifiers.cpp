@@ -425,8 +425,13 @@ template<class T>
 void ObjectUpdater::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
         if (iter->GetSource()->IsInWorld())
+        {
             iter->GetSource()->Update(i_timeDiff);
+            ++i_updatedObjects;
+        }
+    }
 }
 
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
@@ -191,7 +191,8 @@ namespace Trinity
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) { }
+        uint32 i_updatedObjects;
+        explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff), i_updatedObjects(0) { }
         template<class T> void Visit(GridRefManager<T> &m);
         void Visit(PlayerMapType &) { }
         void Visit(CorpseMapType &) { }
@@ -17,6 +17,7 @@
 
 #include "ObjectGridLoader.h"
 #include "CellImpl.h"
+#include "Containers.h"
 #include "Corpse.h"
 #include "Creature.h"
 #include "CreatureAI.h"
@@ -121,15 +122,15 @@ void LoadHelper(CellGuidSet const& guid_set, CellCoord &cell, GridRefManager<T>
 void ObjectGridLoader::Visit(GameObjectMapType &m)
 {
     CellCoord cellCoord = i_cell.GetCellCoord();
-    if (CellObjectGuids const* cell_guids = sObjectMgr->GetCellObjectGuids(i_map->GetId(), i_map->GetSpawnMode(), cellCoord.GetId()))
-        LoadHelper(cell_guids->gameobjects, cellCoord, m, i_gameObjects, i_map);
+    if (i_cellGuids)
+        LoadHelper(i_cellGuids->gameobjects, cellCoord, m, i_gameObjects, i_map);
 }
 
 void ObjectGridLoader::Visit(CreatureMapType &m)
 {
     CellCoord cellCoord = i_cell.GetCellCoord();
-    if (CellObjectGuids const* cell_guids = sObjectMgr->GetCellObjectGuids(i_map->GetId(), i_map->GetSpawnMode(), cellCoord.GetId()))
-        LoadHelper(cell_guids->creatures, cellCoord, m, i_creatures, i_map);
+    if (i_cellGuids)
+        LoadHelper(i_cellGuids->creatures, cellCoord, m, i_creatures, i_map);
 }
 
 void ObjectWorldLoader::Visit(CorpseMapType& /*m*/)
@@ -151,10 +152,27 @@ void ObjectWorldLoader::Visit(CorpseMapType& /*m*/)
     }
 }
 
+void ObjectGridLoader::LoadCellSpawns(uint32 x, uint32 y, CellObjectGuids const* cellGuids)
+{
+    i_grid.setCellObjectDataLoaded(x, y);
+
+    // cells without spawns are skipped
+    i_cellGuids = cellGuids;
+    if (!i_cellGuids)
+        return;
+
+    TypeContainerVisitor<ObjectGridLoader, GridTypeMapContainer> visitor(*this);
+    i_grid.VisitGrid(x, y, visitor);
+}
+
 void ObjectGridLoader::LoadN(void)
 {
     i_gameObjects = 0; i_creatures = 0; i_corpses = 0;
     i_cell.data.Part.cell_y = 0;
+
+    // one lookup for the whole grid, maps loading cells on demand only get their corpses here
+    CellObjectGuidsMap const* mapGuids = sObjectMgr->GetMapObjectGuids(i_map->GetId(), i_map->GetSpawnMode());
+    bool loadSpawns = !i_map->IsLoadingCellsOnDemand();
     for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
     {
         i_cell.data.Part.cell_x = x;
@@ -163,10 +181,8 @@ void ObjectGridLoader::LoadN(void)
             i_cell.data.Part.cell_y = y;
 
             //Load creatures and game objects
-            {
-                TypeContainerVisitor<ObjectGridLoader, GridTypeMapContainer> visitor(*this);
-                i_grid.VisitGrid(x, y, visitor);
-            }
+            if (loadSpawns)
+                LoadCellSpawns(x, y, mapGuids ? Trinity::Containers::MapGetValuePtr(*mapGuids, i_cell.GetCellCoord().GetId()) : nullptr);
 
             //Load corpses (not bones)
             {
@@ -179,6 +195,16 @@ void ObjectGridLoader::LoadN(void)
     TC_LOG_DEBUG("maps", "{} GameObjects, {} Creatures, and {} Corpses/Bones loaded for grid {} on map {}", i_gameObjects, i_creatures, i_corpses, i_grid.GetGridId(), i_map->GetId());
 }
 
+void ObjectGridLoader::LoadCell()
+{
+    i_gameObjects = 0; i_creatures = 0;
+
+    CellObjectGuidsMap const* mapGuids = sObjectMgr->GetMapObjectGuids(i_map->GetId(), i_map->GetSpawnMode());
+    LoadCellSpawns(i_cell.CellX(), i_cell.CellY(), mapGuids ? Trinity::Containers::MapGetValuePtr(*mapGuids, i_cell.GetCellCoord().GetId()) : nullptr);
+
+    TC_LOG_DEBUG("maps", "{} GameObjects and {} Creatures loaded for cell [{}, {}] of grid {} on map {}", i_gameObjects, i_creatures, i_cell.CellX(), i_cell.CellY(), i_grid.GetGridId(), i_map->GetId());
+}
+
 template<class T>
 void ObjectGridUnloader::Visit(GridRefManager<T> &m)
 {
@@ -26,6 +26,7 @@
 
 class MapObject;
 class ObjectWorldLoader;
+struct CellObjectGuids;
 
 class TC_GAME_API ObjectGridLoader
 {
@@ -33,7 +34,7 @@ class TC_GAME_API ObjectGridLoader
 
     public:
         ObjectGridLoader(NGridType& grid, Map* map, Cell const& cell)
-            : i_cell(cell), i_grid(grid), i_map(map), i_gameObjects(0), i_creatures(0), i_corpses (0)
+            : i_cell(cell), i_grid(grid), i_map(map), i_cellGuids(nullptr), i_gameObjects(0), i_creatures(0), i_corpses (0)
             { }
 
         void Visit(GameObjectMapType &m);
@@ -42,13 +43,18 @@ class TC_GAME_API ObjectGridLoader
         void Visit(DynamicObjectMapType&) const { }
 
         void LoadN(void);
+        // creates the creatures and gameobjects of the cell passed to the constructor, for maps loading cells on demand
+        void LoadCell();
 
         static void SetObjectCell(MapObject* obj, CellCoord const& cellCoord);
 
     private:
+        void LoadCellSpawns(uint32 x, uint32 y, CellObjectGuids const* cellGuids);
+
         Cell i_cell;
         NGridType &i_grid;
         Map* i_map;
+        CellObjectGuids const* i_cellGuids;                 // spawns of the cell being loaded
         uint32 i_gameObjects;
         uint32 i_creatures;
         uint32 i_corpses;
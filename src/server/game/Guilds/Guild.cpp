@@ -38,6 +38,7 @@
 #include "World.h"
 #include "WorldSession.h"
 #include <boost/iterator/counting_iterator.hpp>
+#include <mutex>
 
 size_t const MAX_GUILD_BANK_TAB_TEXT_LEN = 500;
 
@@ -1073,7 +1074,8 @@ Guild::Guild():
     m_leaderGuid(),
     m_createdDate(0),
     m_accountsNumber(0),
-    m_bankMoney(0)
+    m_bankMoney(0),
+    m_rosterVersion(1)
 {
 }
 
@@ -1205,7 +1207,7 @@ void Guild::UpdateMemberData(Player* player, uint8 dataid, uint32 value)
                 TC_LOG_ERROR("guild", "Guild::UpdateMemberData: Called with incorrect DATAID {} (value {})", dataid, value);
                 return;
         }
-        //HandleRoster();
+        // No _InvalidateRoster() here, HandleRoster refreshes level and zone in the cached packet
     }
 }
 
@@ -1216,6 +1218,7 @@ void Guild::OnPlayerStatusChange(Player* player, uint32 flag, bool state)
         if (state)
             member->AddFlag(flag);
         else member->RemFlag(flag);
+        _InvalidateRoster();
     }
 }
 
@@ -1234,49 +1237,80 @@ bool Guild::SetName(std::string_view name)
 
 void Guild::HandleRoster(WorldSession* session)
 {
-    WorldPackets::Guild::GuildRoster roster;
-
-    roster.RankData.reserve(m_ranks.size());
-    for (RankInfo const& rank : m_ranks)
+    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
+    RosterCache& cache = m_rosterCache[sendOfficerNote ? 1 : 0];
+    time_t now = GameTime::GetGameTime();
+    uint32 rosterVersion = m_rosterVersion;
+    if (!cache.Packet || cache.Version != rosterVersion || now - cache.BuildTime >= GUILD_ROSTER_CACHE_TIME)
     {
-        WorldPackets::Guild::GuildRankData& rankData =  roster.RankData.emplace_back();
+        WorldPackets::Guild::GuildRoster roster;
 
-        rankData.Flags = rank.GetRights();
-        rankData.WithdrawGoldLimit = rank.GetBankMoneyPerDay();
-        for (uint8 i = 0; i < GUILD_BANK_MAX_TABS; ++i)
+        roster.RankData.reserve(m_ranks.size());
+        for (RankInfo const& rank : m_ranks)
         {
-            rankData.TabFlags[i] = rank.GetBankTabRights(i);
-            rankData.TabWithdrawItemLimit[i] = rank.GetBankTabSlotsPerDay(i);
+            WorldPackets::Guild::GuildRankData& rankData =  roster.RankData.emplace_back();
+
+            rankData.Flags = rank.GetRights();
+            rankData.WithdrawGoldLimit = rank.GetBankMoneyPerDay();
+            for (uint8 i = 0; i < GUILD_BANK_MAX_TABS; ++i)
+            {
+                rankData.TabFlags[i] = rank.GetBankTabRights(i);
+                rankData.TabWithdrawItemLimit[i] = rank.GetBankTabSlotsPerDay(i);
+            }
         }
-    }
 
-    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
-    roster.MemberData.reserve(m_members.size());
-    for (auto const& [guid, member] : m_members)
-    {
-        WorldPackets::Guild::GuildRosterMemberData& memberData = roster.MemberData.emplace_back();
+        roster.MemberData.reserve(m_members.size());
+        for (auto const& [guid, member] : m_members)
+        {
+            WorldPackets::Guild::GuildRosterMemberData& memberData = roster.MemberData.emplace_back();
+
+            memberData.Guid = member.GetGUID();
+            memberData.RankID = int32(member.GetRankId());
+            memberData.AreaID = int32(member.GetZoneId());
+            memberData.LastSave = float(float(now - member.GetLogoutTime()) / float(DAY));
+
+            memberData.Status = member.GetFlags();
+            memberData.Level = member.GetLevel();
+            memberData.ClassID = member.GetClass();
+            memberData.Gender = member.GetGender();
+
+            memberData.Name = member.GetName();
+            memberData.Note = member.GetPublicNote();
+            if (sendOfficerNote)
+                memberData.OfficerNote = member.GetOfficerNote();
+        }
+
+        roster.WelcomeText = m_motd;
+        roster.InfoText = m_info;
 
-        memberData.Guid = member.GetGUID();
-        memberData.RankID = int32(member.GetRankId());
-        memberData.AreaID = int32(member.GetZoneId());
-        memberData.LastSave = float(float(GameTime::GetGameTime() - member.GetLogoutTime()) / float(DAY));
+        roster.Write();
+        roster.ShrinkToFit();
 
-        memberData.Status = member.GetFlags();
-        memberData.Level = member.GetLevel();
-        memberData.ClassID = member.GetClass();
-        memberData.Gender = member.GetGender();
+        cache.MemberLevelPositions.clear();
+        cache.MemberLevelPositions.reserve(roster.MemberLevelPositions.size());
+        for (std::size_t i = 0; i < roster.MemberLevelPositions.size(); ++i)
+            cache.MemberLevelPositions.emplace_back(roster.MemberData[i].Guid.GetCounter(), roster.MemberLevelPositions[i]);
 
-        memberData.Name = member.GetName();
-        memberData.Note = member.GetPublicNote();
-        if (sendOfficerNote)
-            memberData.OfficerNote = member.GetOfficerNote();
+        cache.Packet = std::make_unique<WorldPacket>(roster.Move());
+        cache.Version = rosterVersion;
+        cache.BuildTime = now;
     }
+    else
+    {
+        for (auto const& [lowGuid, levelPos] : cache.MemberLevelPositions)
+        {
+            auto itr = m_members.find(lowGuid);
+            if (itr == m_members.end())
+                continue;
 
-    roster.WelcomeText = m_motd;
-    roster.InfoText = m_info;
+            cache.Packet->put<uint8>(levelPos, itr->second.GetLevel());
+            // ClassID and Gender sit between Level and AreaID
+            cache.Packet->put<int32>(levelPos + 3, int32(itr->second.GetZoneId()));
+        }
+    }
 
     TC_LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
-    session->SendPacket(roster.Write());
+    session->SendPacket(cache.Packet.get());
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -1312,6 +1346,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string_view motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, m_motd);
 
@@ -1333,6 +1368,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string_view info)
     if (_HasRankRight(session->GetPlayer(), GR_RIGHT_MODIFY_GUILD_INFO))
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, m_info);
 
@@ -1384,6 +1420,7 @@ void Guild::HandleSetNewGuildMaster(WorldSession* session, std::string_view name
 
     _SetLeader(trans, *newGuildMaster);
     oldGuildMaster->ChangeRank(trans, GR_OFFICER);
+    _InvalidateRoster();
 
     _BroadcastEvent(GE_LEADER_CHANGED, ObjectGuid::Empty, player->GetName(), newGuildMaster->GetName());
 
@@ -1416,6 +1453,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, std::string_view note, st
         else
             member->SetOfficerNote(note);
 
+        _InvalidateRoster();
         HandleRoster(session);
     }
 }
@@ -1429,6 +1467,7 @@ void Guild::HandleSetRankInfo(WorldSession* session, uint8 rankId, std::string_v
     {
         rankInfo->SetName(name);
         rankInfo->SetRights(rights);
+        _InvalidateRoster();
         _SetRankBankMoneyPerDay(rankId, moneyPerDay);
 
         for (auto itr = rightsAndSlots.begin(); itr != rightsAndSlots.end(); ++itr)
@@ -1645,6 +1684,7 @@ void Guild::HandleUpdateMemberRank(WorldSession* session, std::string_view name,
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         CharacterDatabaseTransaction trans(nullptr);
         member->ChangeRank(trans, newRankId);
+        _InvalidateRoster();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER : GUILD_EVENT_LOG_PROMOTE_PLAYER, player->GetGUID().GetCounter(), member->GetGUID().GetCounter(), newRankId);
         _BroadcastEvent(demote ? GE_DEMOTION : GE_PROMOTION, ObjectGuid::Empty, player->GetName(), member->GetName(), _GetRankName(newRankId));
     }
@@ -1689,6 +1729,7 @@ void Guild::HandleRemoveRank(WorldSession* session, uint8 rankId)
 
     // match what the sql statement does
     m_ranks.erase(m_ranks.begin() + rankId, m_ranks.end());
+    _InvalidateRoster();
 
     _BroadcastEvent(GE_RANK_DELETED, ObjectGuid::Empty, std::to_string(m_ranks.size()));
 }
@@ -1776,6 +1817,11 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        _InvalidateRoster();
+    }
+    {
+        std::unique_lock<std::shared_mutex> lock(m_onlineMembersLock);
+        m_onlineMembers.erase(player->GetGUID().GetCounter());
     }
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
 }
@@ -1903,13 +1949,19 @@ void Guild::SendLoginInfo(WorldSession* session)
     Player* player = session->GetPlayer();
 
     HandleRoster(session);
-    _BroadcastEvent(GE_SIGNED_ON, player->GetGUID(), player->GetName());
 
     if (Member* member = GetMember(player->GetGUID()))
     {
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+        {
+            std::unique_lock<std::shared_mutex> lock(m_onlineMembersLock);
+            m_onlineMembers[player->GetGUID().GetCounter()] = session;
+        }
+        _InvalidateRoster();
     }
+
+    _BroadcastEvent(GE_SIGNED_ON, player->GetGUID(), player->GetName());
 }
 
 // Loading methods
@@ -2130,27 +2182,31 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindConnectedPlayer())
-                if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
+        std::shared_lock<std::shared_mutex> lock(m_onlineMembersLock);
+        for (auto const& [guid, memberSession] : m_onlineMembers)
+            if (Player* player = memberSession->GetPlayer())
+                if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
                     !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
-                    player->SendDirectMessage(&data);
+                    memberSession->SendPacket(&data);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (member.IsRank(rankId))
-            if (Player* player = member.FindConnectedPlayer())
-                player->SendDirectMessage(packet);
+    std::shared_lock<std::shared_mutex> lock(m_onlineMembersLock);
+    for (auto const& [guid, session] : m_onlineMembers)
+    {
+        auto itr = m_members.find(guid);
+        if (itr != m_members.end() && itr->second.IsRank(rankId))
+            session->SendPacket(packet);
+    }
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (Player* player = member.FindConnectedPlayer())
-            player->SendDirectMessage(packet);
+    std::shared_lock<std::shared_mutex> lock(m_onlineMembersLock);
+    for (auto const& [guid, session] : m_onlineMembers)
+        session->SendPacket(packet);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
@@ -2255,6 +2311,7 @@ bool Guild::AddMember(CharacterDatabaseTransaction trans, ObjectGuid guid, uint8
     }
 
     member.SaveToDB(trans);
+    _InvalidateRoster();
 
     _UpdateAccountsNumber();
     _LogEvent(GUILD_EVENT_LOG_JOIN_GUILD, lowguid);
@@ -2308,6 +2365,11 @@ bool Guild::DeleteMember(CharacterDatabaseTransaction trans, ObjectGuid guid, bo
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     m_members.erase(lowguid);
+    {
+        std::unique_lock<std::shared_mutex> lock(m_onlineMembersLock);
+        m_onlineMembers.erase(lowguid);
+    }
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -2338,6 +2400,7 @@ bool Guild::ChangeMemberRank(CharacterDatabaseTransaction trans, ObjectGuid guid
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(trans, newRank);
+            _InvalidateRoster();
             return true;
         }
     }
@@ -2397,6 +2460,11 @@ void Guild::SetBankTabText(uint8 tabId, std::string_view text)
     }
 }
 
+Player* Guild::_GetSessionPlayer(WorldSession* session)
+{
+    return session->GetPlayer();
+}
+
 bool Guild::_HasRankRight(Player* player, uint32 right) const
 {
     if (player)
@@ -2435,6 +2503,7 @@ void Guild::_CreateNewBankTab()
         (*itr).CreateMissingTabsIfNeeded(tabId, trans, false);
 
     CharacterDatabase.CommitTransaction(trans);
+    _InvalidateRoster();
 }
 
 void Guild::_CreateDefaultGuildRanks(CharacterDatabaseTransaction trans, LocaleConstant loc)
@@ -2465,6 +2534,7 @@ bool Guild::_CreateRank(CharacterDatabaseTransaction trans, std::string_view nam
     // Ranks represent sequence 0, 1, 2, ... where 0 means guildmaster
     RankInfo info(m_id, newRankId, name, rights, 0);
     m_ranks.push_back(info);
+    _InvalidateRoster();
 
     bool const isInTransaction = bool(trans);
     if (!isInTransaction)
@@ -2538,6 +2608,7 @@ void Guild::_SetLeader(CharacterDatabaseTransaction trans, Member& leader)
 
     m_leaderGuid = leader.GetGUID();
     leader.ChangeRank(trans, GR_GUILDMASTER);
+    _InvalidateRoster();
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->setUInt32(0, m_leaderGuid.GetCounter());
@@ -2551,7 +2622,10 @@ void Guild::_SetLeader(CharacterDatabaseTransaction trans, Member& leader)
 void Guild::_SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay)
 {
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankMoneyPerDay(moneyPerDay);
+        _InvalidateRoster();
+    }
 }
 
 void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots rightsAndSlots, bool saveToDB)
@@ -2560,7 +2634,10 @@ void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots
         return;
 
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankTabSlotsAndRights(rightsAndSlots, saveToDB);
+        _InvalidateRoster();
+    }
 }
 
 inline std::string Guild::_GetRankName(uint8 rankId) const
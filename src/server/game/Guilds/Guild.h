@@ -23,7 +23,9 @@
 #include "Optional.h"
 #include "SharedDefines.h"
 #include "UniqueTrackablePtr.h"
+#include <atomic>
 #include <set>
+#include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -57,6 +59,7 @@ enum GuildMisc
     GUILD_WITHDRAW_SLOT_UNLIMITED       = 0xFFFFFFFF,
     GUILD_EVENT_LOG_GUID_UNDEFINED      = 0xFFFFFFFF,
     TAB_UNDEFINED                       = 0xFF,
+    GUILD_ROSTER_CACHE_TIME             = 60,                   // seconds a cached roster is reused, bounds the age of LastSave
 };
 
 constexpr uint64 GUILD_BANK_MONEY_LIMIT = UI64LIT(0x7FFFFFFFFFFFF);
@@ -705,8 +708,9 @@ class TC_GAME_API Guild
         template<class Do>
         void BroadcastWorker(Do& _do, Player* except = nullptr)
         {
-            for (auto itr = m_members.begin(); itr != m_members.end(); ++itr)
-                if (Player* player = itr->second.FindConnectedPlayer())
+            std::shared_lock<std::shared_mutex> lock(m_onlineMembersLock);
+            for (auto const& [guid, session] : m_onlineMembers)
+                if (Player* player = _GetSessionPlayer(session))
                     if (player != except)
                         _do(player);
         }
@@ -749,6 +753,23 @@ class TC_GAME_API Guild
         std::unordered_map<uint32, Member> m_members;
         std::vector<BankTab> m_bankTabs;
 
+        // Sessions of members that are logged in, kept by SendLoginInfo/HandleMemberLogout/DeleteMember
+        // Changed on the world thread but also iterated by map threads (achievement broadcasts), hence the lock
+        std::unordered_map<uint32, WorldSession*> m_onlineMembers;
+        mutable std::shared_mutex m_onlineMembersLock;
+
+        // SMSG_GUILD_ROSTER is rebuilt only when m_rosterVersion moves on; index 1 holds the variant with officer notes
+        // Level and zone are patched into the cached packet on send (MemberLevelPositions), they change too often to rebuild
+        struct RosterCache
+        {
+            std::unique_ptr<WorldPacket> Packet;
+            std::vector<std::pair<uint32, std::size_t>> MemberLevelPositions;
+            uint32 Version = 0;
+            time_t BuildTime = 0;
+        };
+        std::array<RosterCache, 2> m_rosterCache;
+        std::atomic<uint32> m_rosterVersion;
+
         // These are actually ordered lists. The first element is the oldest entry.
         LogHolder<EventLogEntry> m_eventLog;
         std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> m_bankEventLog = {};
@@ -760,9 +781,14 @@ class TC_GAME_API Guild
         inline RankInfo const* GetRankInfo(uint8 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
         inline RankInfo* GetRankInfo(uint8 rankId) { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
         bool _HasRankRight(Player* player, uint32 right) const;
+        // WorldSession is incomplete here, BroadcastWorker gets its players through this
+        static Player* _GetSessionPlayer(WorldSession* session);
 
         inline uint8 _GetLowestRankId() const { return uint8(m_ranks.size() - 1); }
 
+        // Must be called after every change of data sent in SMSG_GUILD_ROSTER
+        inline void _InvalidateRoster() { ++m_rosterVersion; }
+
         inline uint8 _GetPurchasedTabsSize() const { return uint8(m_bankTabs.size()); }
         inline BankTab* GetBankTab(uint8 tabId) { return tabId < m_bankTabs.size() ? &m_bankTabs[tabId] : nullptr; }
         inline BankTab const* GetBankTab(uint8 tabId) const { return tabId < m_bankTabs.size() ? &m_bankTabs[tabId] : nullptr; }
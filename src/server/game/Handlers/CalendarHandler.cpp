@@ -458,7 +458,7 @@ void WorldSession::HandleCalendarEventInvite(WorldPackets::Calendar::CalendarInv
     else
     {
         // Invitee offline, get data from storage
-        CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByName(inviteeName);
+        Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByName(inviteeName);
         if (!characterInfo)
         {
             sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_PLAYER_NOT_FOUND);
@@ -662,7 +662,7 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
         return;
     }
 
-    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(guid);
+    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(guid);
     if (!characterInfo)
     {
         sScriptMgr->OnPlayerFailedDelete(guid, initAccountId);
@@ -1647,7 +1647,7 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
     }
 
     // get the players old (at this moment current) race
-    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(factionChangeInfo->Guid);
+    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(factionChangeInfo->Guid);
     if (!characterInfo)
     {
         SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo.get());
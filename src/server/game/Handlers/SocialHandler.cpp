@@ -46,7 +46,7 @@ void WorldSession::HandleAddFriendOpcode(WorldPacket& recvData)
     TC_LOG_DEBUG("network", "WorldSession::HandleAddFriendOpcode: {} asked to add friend: {}",
         GetPlayer()->GetName(), friendName);
 
-    CharacterCacheEntry const* friendCharacterInfo = sCharacterCache->GetCharacterCacheByName(friendName);
+    Optional<CharacterCacheEntry> friendCharacterInfo = sCharacterCache->GetCharacterCacheByName(friendName);
     if (!friendCharacterInfo)
     {
         sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
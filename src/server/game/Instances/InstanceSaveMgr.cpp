@@ -29,6 +29,7 @@
 #include "Map.h"
 #include "MapInstanced.h"
 #include "MapManager.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "Timer.h"
@@ -48,6 +49,10 @@ InstanceSaveManager* InstanceSaveManager::instance()
 
 void InstanceSaveManager::Unload()
 {
+    // bind changes of pending global resets are already queued in the DB
+    m_resetTransactionCallbacks.CancelAll();
+    m_pendingGlobalResets.clear();
+
     lock_instLists = true;
     for (InstanceSaveHashMap::iterator itr = m_instanceSaveById.begin(); itr != m_instanceSaveById.end(); ++itr)
     {
@@ -545,6 +550,9 @@ void InstanceSaveManager::Update()
             m_resetTimeQueue.erase(m_resetTimeQueue.begin());
         }
     }
+
+    m_resetTransactionCallbacks.ProcessReadyCallbacks();
+    _UpdatePendingGlobalResets();
 }
 
 void InstanceSaveManager::_ResetSave(InstanceSaveHashMap::iterator &itr)
@@ -641,6 +649,14 @@ void InstanceSaveManager::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, b
         if (!next_reset)
             return;
 
+        PendingGlobalReset& reset = m_pendingGlobalResets.emplace_back(mapid, difficulty, next_reset);
+        reset.StartTime = getMSTime();
+
+        // collect the maps existing now, anything created later already belongs to the next period
+        Map* baseMap = sMapMgr->CreateBaseMap(mapid);        // _not_ include difficulty
+        for (auto const& [instanceId, map] : baseMap->ToMapInstanced()->GetInstancedMaps())
+            reset.MapInstanceIds.push_back(instanceId);
+
         // delete/promote instance binds from the DB, even if not loaded
         CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
@@ -664,9 +680,18 @@ void InstanceSaveManager::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, b
         stmt->setUInt8(1, uint8(difficulty));
         trans->Append(stmt);
 
-        CharacterDatabase.CommitTransaction(trans);
+        // the loaded instance maps are reset by _UpdatePendingGlobalResets once the DB has been updated
+        m_resetTransactionCallbacks.AddCallback(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete([&reset](bool success)
+        {
+            if (!success)
+                TC_LOG_ERROR("misc", "InstanceSaveManager::ResetOrWarnAll: Failed to delete expired binds of map {} on difficulty {}, resetting loaded instances anyway",
+                    reset.MapId, static_cast<uint32>(reset.MapDifficulty));
+
+            reset.DatabaseDone = true;
+        });
 
-        // promote loaded binds to instances of the given map
+        // promote loaded binds to instances of the given map in the same tick, so no new bind row
+        // can be written for an old period save between the delete above and its promotion
         for (InstanceSaveHashMap::iterator itr = m_instanceSaveById.begin(); itr != m_instanceSaveById.end();)
         {
             if (itr->second->GetMapId() == mapid && itr->second->GetDifficulty() == difficulty)
@@ -686,29 +711,63 @@ void InstanceSaveManager::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, b
         stmt->setUInt8(2, uint8(difficulty));
 
         CharacterDatabase.Execute(stmt);
+        return;
     }
 
     // note: this isn't fast but it's meant to be executed very rarely
     Map* baseMap = sMapMgr->CreateBaseMap(mapid);            // _not_ include difficulty
-    uint32 timeLeft;
+    uint32 timeLeft = now >= resetTime ? 0 : uint32(resetTime - now);
 
     for (auto& [_, map] : baseMap->ToMapInstanced()->GetInstancedMaps())
+        map->ToInstanceMap()->SendResetWarnings(timeLeft);
+
+    /// @todo delete creature/gameobject respawn times even if the maps are not loaded
+}
+
+void InstanceSaveManager::_UpdatePendingGlobalResets()
+{
+    uint32 const batchSize = sWorld->getIntConfig(CONFIG_INSTANCE_RESET_BATCH_SIZE);
+    uint32 processed = 0;
+    auto hasBudget = [&]() { return !batchSize || processed < batchSize; };
+
+    // resets are applied in the order they were scheduled, a later one never overtakes an uncommitted one
+    while (!m_pendingGlobalResets.empty() && m_pendingGlobalResets.front().DatabaseDone && hasBudget())
     {
-        InstanceMap* instanceMap = map->ToInstanceMap();
-        if (warn)
+        PendingGlobalReset& reset = m_pendingGlobalResets.front();
+
+        MapInstanced* baseMap = sMapMgr->CreateBaseMap(reset.MapId)->ToMapInstanced();
+        while (reset.ProcessedMaps < reset.MapInstanceIds.size() && hasBudget())
         {
-            if (now >= resetTime)
-                timeLeft = 0;
-            else
-                timeLeft = uint32(resetTime - now);
+            uint32 instanceId = reset.MapInstanceIds[reset.ProcessedMaps++];
+            Map* map = baseMap->FindInstanceMap(instanceId);
+            if (!map)
+                continue;
 
-            instanceMap->SendResetWarnings(timeLeft);
+            // skip maps of instances created after the reset that reuse a freed id
+            InstanceSave* save = GetInstanceSave(instanceId);
+            if (save && save->GetDifficulty() == reset.MapDifficulty && save->GetResetTime() >= reset.NextResetTime)
+                continue;
+
+            map->ToInstanceMap()->Reset(INSTANCE_RESET_GLOBAL);
+            ++processed;
         }
-        else
-            instanceMap->Reset(INSTANCE_RESET_GLOBAL);
-    }
 
-    /// @todo delete creature/gameobject respawn times even if the maps are not loaded
+        TC_METRIC_VALUE("instance_reset_pending", uint64(reset.MapInstanceIds.size() - reset.ProcessedMaps),
+            TC_METRIC_TAG("map_id", std::to_string(reset.MapId)),
+            TC_METRIC_TAG("difficulty", std::to_string(static_cast<uint32>(reset.MapDifficulty))));
+
+        if (reset.ProcessedMaps < reset.MapInstanceIds.size())
+            break;
+
+        uint32 duration = GetMSTimeDiffToNow(reset.StartTime);
+        TC_METRIC_VALUE("instance_reset_time", uint64(duration),
+            TC_METRIC_TAG("map_id", std::to_string(reset.MapId)),
+            TC_METRIC_TAG("difficulty", std::to_string(static_cast<uint32>(reset.MapDifficulty))));
+        TC_LOG_DEBUG("misc", "InstanceSaveManager::ResetOrWarnAll: Finished reset of map {} on difficulty {} ({} maps) in {} ms",
+            reset.MapId, static_cast<uint32>(reset.MapDifficulty), reset.MapInstanceIds.size(), duration);
+
+        m_pendingGlobalResets.pop_front();
+    }
 }
 
 uint32 InstanceSaveManager::GetNumBoundPlayersTotal() const
@@ -22,7 +22,9 @@
 #include <map>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
+#include "AsyncCallbackProcessor.h"
 #include "Define.h"
 #include "DatabaseEnvFwd.h"
 #include "DBCEnums.h"
@@ -222,9 +224,26 @@ class TC_GAME_API InstanceSaveManager
         static uint16 ResetTimeDelay[];
 
     private:
+        /* a global reset promotes the loaded saves and commits the bind deletes/promotions asynchronously right away,
+           the loaded instance maps are reset a batch at a time once that transaction is done */
+        struct PendingGlobalReset
+        {
+            PendingGlobalReset(uint32 mapId, Difficulty difficulty, time_t nextResetTime)
+                : MapId(mapId), MapDifficulty(difficulty), NextResetTime(nextResetTime) { }
+
+            uint32 MapId;
+            Difficulty MapDifficulty;
+            time_t NextResetTime;
+            std::vector<uint32> MapInstanceIds;
+            std::size_t ProcessedMaps = 0;
+            bool DatabaseDone = false;
+            uint32 StartTime = 0;
+        };
+
         void _ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool warn, time_t resetTime);
         void _ResetInstance(uint32 mapid, uint32 instanceId);
         void _ResetSave(InstanceSaveHashMap::iterator &itr);
+        void _UpdatePendingGlobalResets();
         // used during global instance resets
         bool lock_instLists;
         // fast lookup by instance id
@@ -232,6 +251,9 @@ class TC_GAME_API InstanceSaveManager
         // fast lookup for reset times (always use existed functions for access/set)
         ResetTimeByMapDifficultyMap m_resetTimeByMapDifficulty;
         ResetTimeQueue m_resetTimeQueue;
+        // global resets waiting for their transaction or still being processed, in scheduling order
+        std::list<PendingGlobalReset> m_pendingGlobalResets;
+        AsyncCallbackProcessor<TransactionCallback> m_resetTransactionCallbacks;
 };
 
 #define sInstanceSaveMgr InstanceSaveManager::instance()
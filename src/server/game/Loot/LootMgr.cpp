@@ -16,6 +16,7 @@
  */
 
 #include "LootMgr.h"
+#include "AliasTable.h"
 #include "Containers.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
@@ -59,7 +60,7 @@ struct LootGroupInvalidSelector
 {
     explicit LootGroupInvalidSelector(Loot const& loot, uint16 lootMode) : _loot(loot), _lootMode(lootMode) { }
 
-    bool operator()(LootStoreItem* item) const
+    bool operator()(LootStoreItem const* item) const
     {
         if (!(item->lootmode & _lootMode))
             return true;
@@ -85,6 +86,7 @@ class LootTemplate::LootGroup                               // A set of loot def
         ~LootGroup();
 
         void AddEntry(LootStoreItem* item);                 // Adds an entry to the group (at loading stage)
+        void Compile();                                     // Builds the roll tables (at loading stage, after all entries are added)
         bool HasQuestDrop() const;                          // True if group includes at least 1 quest drop entry
         bool HasQuestDropForPlayer(Player const* player) const;
                                                             // The same for active quests of the player
@@ -101,6 +103,14 @@ class LootTemplate::LootGroup                               // A set of loot def
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+        // Compiled form of the lists above, valid while every entry can drop
+        std::vector<LootStoreItem const*> _explicitlyChancedItems;
+        std::vector<LootStoreItem const*> _equalChancedItems;
+        Trinity::AliasTable _explicitChanceTable;           // Last outcome (if present) is the miss that falls through to equal chanced entries
+        std::vector<uint32> _itemIds;                       // Sorted, for the duplicate check
+        uint16 _commonLootMode = 0;                         // Loot modes shared by all entries
+
+        bool CanUseCompiledRoll(Loot const& loot, uint16 lootMode) const;
         LootStoreItem const* Roll(Loot& loot, uint16 lootMode) const;   // Rolls an item from the group, returns NULL if all miss their chances
 
         // This class must never be copied - storing pointers
@@ -190,6 +200,9 @@ uint32 LootStore::LoadLootTable()
     }
     while (result->NextRow());
 
+    for (auto const& [id, lootTemplate] : m_LootTemplates)
+        lootTemplate->Compile();
+
     Verify();                                           // Checks validity of the loot store
 
     return count;
@@ -371,30 +384,98 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
         EqualChanced.push_back(item);
 }
 
+// Builds the roll tables (at loading stage, after all entries are added)
+void LootTemplate::LootGroup::Compile()
+{
+    _explicitlyChancedItems.assign(ExplicitlyChanced.begin(), ExplicitlyChanced.end());
+    _equalChancedItems.assign(EqualChanced.begin(), EqualChanced.end());
+
+    _commonLootMode = 0xFFFF;
+    _itemIds.clear();
+    for (LootStoreItem const* item : _explicitlyChancedItems)
+    {
+        _commonLootMode &= item->lootmode;
+        _itemIds.push_back(item->itemid);
+    }
+    for (LootStoreItem const* item : _equalChancedItems)
+    {
+        _commonLootMode &= item->lootmode;
+        _itemIds.push_back(item->itemid);
+    }
+    std::sort(_itemIds.begin(), _itemIds.end());
+
+    _explicitChanceTable = Trinity::AliasTable();
+    if (_explicitlyChancedItems.empty())
+        return;
+
+    // Same outcome as walking the list with a single rand_chance() roll: every entry
+    // takes its chance from what is left of 100%, the remainder is a miss
+    std::vector<double> weights;
+    weights.reserve(_explicitlyChancedItems.size() + 1);
+    double remaining = 100.0;
+    for (LootStoreItem const* item : _explicitlyChancedItems)
+    {
+        double chance = item->chance >= 100.0f ? remaining : std::min<double>(item->chance, remaining);
+        weights.push_back(chance);
+        remaining -= chance;
+    }
+
+    if (remaining > 0.0)
+        weights.push_back(remaining);
+
+    _explicitChanceTable = Trinity::AliasTable(weights);
+}
+
+// The compiled tables assume that every entry of the group can drop
+bool LootTemplate::LootGroup::CanUseCompiledRoll(Loot const& loot, uint16 lootMode) const
+{
+    if (!(_commonLootMode & lootMode))
+        return false;
+
+    for (LootItem const& lootItem : loot.items)
+        if (std::binary_search(_itemIds.begin(), _itemIds.end(), lootItem.itemid))
+            return false;
+
+    return true;
+}
+
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    if (CanUseCompiledRoll(loot, lootMode))
+    {
+        if (!_explicitChanceTable.empty())
+        {
+            uint32 index = _explicitChanceTable.Roll();
+            if (index < _explicitlyChancedItems.size())
+                return _explicitlyChancedItems[index];
+        }
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+        if (!_equalChancedItems.empty())
+            return _equalChancedItems[urand(0, uint32(_equalChancedItems.size()) - 1)];
+
+        return nullptr;
+    }
+
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
+
+    float roll = _explicitlyChancedItems.empty() ? 0.0f : (float)rand_chance();
+    for (LootStoreItem const* item : _explicitlyChancedItems)   // check each explicitly chanced entry in the template and modify its chance based on quality.
     {
-        float roll = (float)rand_chance();
+        if (isInvalid(item))
+            continue;
 
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
-        {
-            LootStoreItem* item = *itr;
-            if (item->chance >= 100.0f)
-                return item;
+        if (item->chance >= 100.0f)
+            return item;
 
-            roll -= item->chance;
-            if (roll < 0)
-                return item;
-        }
+        roll -= item->chance;
+        if (roll < 0)
+            return item;
     }
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    std::vector<LootStoreItem const*> possibleLoot;
+    possibleLoot.reserve(_equalChancedItems.size());
+    std::copy_if(_equalChancedItems.begin(), _equalChancedItems.end(), std::back_inserter(possibleLoot), [&](LootStoreItem const* item) { return !isInvalid(item); });
     if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
         return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
 
@@ -518,6 +599,14 @@ LootTemplate::~LootTemplate()
         delete Groups[i];
 }
 
+// Builds the roll tables of all groups (at loading stage, after all entries are added)
+void LootTemplate::Compile()
+{
+    for (LootGroup* group : Groups)
+        if (group)
+            group->Compile();
+}
+
 // Adds an entry to the group (at loading stage)
 void LootTemplate::AddEntry(LootStoreItem* item)
 {
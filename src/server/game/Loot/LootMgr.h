@@ -107,6 +107,8 @@ class TC_GAME_API LootTemplate
 
         // Adds an entry to the group (at loading stage)
         void AddEntry(LootStoreItem* item);
+        // Builds the roll tables of the groups (at loading stage, after all entries are added)
+        void Compile();
         // Rolls for every item in the template and adds the rolled items the the loot
         void Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId = 0) const;
         void CopyConditions(ConditionContainer const& conditions);
@@ -39,9 +39,11 @@
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
 #include "ObjectMgr.h"
+#include "PathCorridorCache.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "ThreadPool.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "VMapFactory.h"
@@ -54,7 +56,8 @@
 #include "Weather.h"
 #include "WeatherMgr.h"
 #include "World.h"
-#include <boost/heap/fibonacci_heap.hpp>
+#include <array>
+#include <atomic>
 #include <unordered_set>
 #include <vector>
 
@@ -70,6 +73,7 @@ static uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 #define DEFAULT_GRID_EXPIRY     300
 #define MAX_GRID_LOAD_TIME      50
 #define MAX_CREATURE_ATTACK_RADIUS  (45.0f * sWorld->getRate(RATE_CREATURE_AGGRO))
+#define MIN_RECEIVERS_FOR_PARALLEL_PACKET_BUILD 8
 
 GridState* si_GridStates[MAX_GRID_STATE];
 
@@ -78,16 +82,203 @@ ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), DefaultWeather(nullptr), Weathe
 
 RespawnInfo::~RespawnInfo() = default;
 
-struct RespawnInfoWithHandle;
-struct RespawnListContainer : boost::heap::fibonacci_heap<RespawnInfoWithHandle*, boost::heap::compare<CompareRespawnInfo>>
+struct RespawnInfoWithHandle : RespawnInfo
 {
+    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other) { }
+
+    // position in RespawnListContainer
+    uint8 level = 0;
+    uint8 slot = 0;
+    uint32 index = 0;
+    bool queued = false;
 };
 
-struct RespawnInfoWithHandle : RespawnInfo
+// Hierarchical timing wheel with one second resolution. Every entry is touched once per level
+// it cascades through, so scheduling and cancelling future respawns are O(1) no matter how many are queued.
+// Entries that are due wait in an indexed binary heap ordered like the old heap, so they are processed
+// in the same order; adding or removing one of them is O(log n) in the number of due entries.
+struct RespawnListContainer
 {
-    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other) { }
+    static constexpr uint32 SLOT_BITS = 8;
+    static constexpr uint32 SLOTS = 1 << SLOT_BITS;
+    static constexpr uint8 LEVELS = 4;                      // 2^32 seconds ahead, later times wait in the overflow slot
+    static constexpr uint8 OVERFLOW_LEVEL = LEVELS;
+    static constexpr uint8 DUE_LEVEL = LEVELS + 1;
+
+    explicit RespawnListContainer(time_t now) : _currentTime(now) { }
+
+    void Insert(RespawnInfoWithHandle* info)
+    {
+        ASSERT(!info->queued);
+        info->queued = true;
+
+        if (info->respawnTime <= _currentTime)
+        {
+            info->level = DUE_LEVEL;
+            info->index = uint32(_due.size());
+            _due.push_back(info);
+            SiftUpDue(info->index);
+            return;
+        }
+
+        uint64 time = uint64(info->respawnTime);
+        uint64 current = uint64(_currentTime);
+        info->level = OVERFLOW_LEVEL;
+        info->slot = 0;
+        for (uint8 level = 0; level < LEVELS; ++level)
+        {
+            uint32 shift = SLOT_BITS * (level + 1);
+            if ((time >> shift) == (current >> shift))
+            {
+                info->level = level;
+                info->slot = uint8(time >> (SLOT_BITS * level));
+                break;
+            }
+        }
+
+        std::vector<RespawnInfoWithHandle*>& slot = GetSlot(info->level, info->slot);
+        info->index = uint32(slot.size());
+        slot.push_back(info);
+    }
+
+    void Remove(RespawnInfoWithHandle* info)
+    {
+        if (!info->queued)
+            return;
+
+        info->queued = false;
+        if (info->level == DUE_LEVEL)
+        {
+            ASSERT(info->index < _due.size() && _due[info->index] == info);
+            RespawnInfoWithHandle* last = _due.back();
+            _due.pop_back();
+            if (last != info)
+            {
+                _due[info->index] = last;
+                last->index = info->index;
+                SiftDownDue(last->index);
+                SiftUpDue(last->index);
+            }
+            return;
+        }
+
+        std::vector<RespawnInfoWithHandle*>& slot = GetSlot(info->level, info->slot);
+        ASSERT(info->index < slot.size() && slot[info->index] == info);
+        slot[info->index] = slot.back();
+        slot[info->index]->index = info->index;
+        slot.pop_back();
+    }
+
+    void Reschedule(RespawnInfoWithHandle* info)
+    {
+        Remove(info);
+        Insert(info);
+    }
+
+    // Returns the earliest entry due at or before now, without removing it
+    RespawnInfoWithHandle* GetNextDue(time_t now)
+    {
+        if (_due.empty())
+            Advance(now);
+
+        return _due.empty() ? nullptr : _due.front();
+    }
+
+    void Clear()
+    {
+        for (std::array<std::vector<RespawnInfoWithHandle*>, SLOTS>& level : _wheel)
+            for (std::vector<RespawnInfoWithHandle*>& slot : level)
+                slot.clear();
+        _overflow.clear();
+        _due.clear();
+    }
+
+private:
+    std::vector<RespawnInfoWithHandle*>& GetSlot(uint8 level, uint8 slot)
+    {
+        return level == OVERFLOW_LEVEL ? _overflow : _wheel[level][slot];
+    }
 
-    RespawnListContainer::handle_type handle;
+    void SwapDue(uint32 a, uint32 b)
+    {
+        std::swap(_due[a], _due[b]);
+        _due[a]->index = a;
+        _due[b]->index = b;
+    }
+
+    // CompareRespawnInfo orders like std::priority_queue, the entry to process next stays at the front
+    void SiftUpDue(uint32 index)
+    {
+        while (index > 0)
+        {
+            uint32 parent = (index - 1) / 2;
+            if (!CompareRespawnInfo()(_due[parent], _due[index]))
+                break;
+
+            SwapDue(parent, index);
+            index = parent;
+        }
+    }
+
+    void SiftDownDue(uint32 index)
+    {
+        while (true)
+        {
+            uint32 child = index * 2 + 1;
+            if (child >= _due.size())
+                break;
+
+            if (child + 1 < _due.size() && CompareRespawnInfo()(_due[child], _due[child + 1]))
+                ++child;
+
+            if (!CompareRespawnInfo()(_due[index], _due[child]))
+                break;
+
+            SwapDue(index, child);
+            index = child;
+        }
+    }
+
+    // Moves every entry of a slot to its place relative to the current time
+    void Cascade(std::vector<RespawnInfoWithHandle*>& slot)
+    {
+        std::vector<RespawnInfoWithHandle*> entries;
+        entries.swap(slot);
+        for (RespawnInfoWithHandle* info : entries)
+        {
+            info->queued = false;
+            Insert(info);
+        }
+    }
+
+    void Advance(time_t now)
+    {
+        while (_currentTime < now)
+        {
+            uint64 time = uint64(++_currentTime);
+
+            // crossing into a new span of a higher level, spread its entries over the lower levels
+            uint8 topLevel = 0;
+            while (topLevel + 1 < LEVELS && (time & ((uint64(1) << (SLOT_BITS * (topLevel + 1))) - 1)) == 0)
+                ++topLevel;
+
+            if (topLevel + 1 == LEVELS && (time & ((uint64(1) << (SLOT_BITS * LEVELS)) - 1)) == 0)
+                Cascade(_overflow);
+
+            for (uint8 level = topLevel; level > 0; --level)
+                Cascade(_wheel[level][uint8(time >> (SLOT_BITS * level))]);
+
+            Cascade(_wheel[0][uint8(time)]);
+
+            if (!_due.empty())
+                break;
+        }
+    }
+
+    time_t _currentTime;
+    std::array<std::array<std::vector<RespawnInfoWithHandle*>, SLOTS>, LEVELS> _wheel;
+    std::vector<RespawnInfoWithHandle*> _overflow;
+    std::vector<RespawnInfoWithHandle*> _due;
 };
 
 Map::~Map()
@@ -96,6 +287,8 @@ Map::~Map()
     // This doesn't delete from database.
     UnloadAllRespawnInfos();
 
+    CommitPlayerSaves();
+
     while (!i_worldObjects.empty())
     {
         WorldObject* obj = *i_worldObjects.begin();
@@ -175,7 +368,11 @@ void Map::LoadMMap(int gx, int gy)
     bool mmapLoadResult = MMAP::MMapFactory::createOrGetMMapManager()->loadMap(sWorld->GetDataPath(), GetId(), gx, gy);
 
     if (mmapLoadResult)
+    {
+        // a new tile may open shorter routes than the cached ones
+        _pathCorridorCache->Clear();
         TC_LOG_DEBUG("mmaps.tiles", "MMAP loaded name:{}, id:{}, x:{}, y:{} (mmap rep.: x:{}, y:{})", GetMapName(), GetId(), gx, gy, gx, gy);
+    }
     else
         TC_LOG_WARN("mmaps.tiles", "Could not load MMAP name:{}, id:{}, x:{}, y:{} (mmap rep.: x:{}, y:{})", GetMapName(), GetId(), gx, gy, gx, gy);
 }
@@ -280,10 +477,13 @@ i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(Inst
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
-i_gridExpiry(expiry),
-i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0)
+i_gridExpiry(expiry), _loadCellsOnDemand(false),
+i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>(GameTime::GetGameTime())), _respawnCheckTimer(0),
+_pathCorridorCache(std::make_unique<PathCorridorCache>(id, InstanceId)), _tickingAuraUpdates(0), _idleAuraUpdates(0)
 {
     m_parentMap = (_parent ? _parent : this);
+    // instance scripts expect every spawn of a loaded grid to exist
+    _loadCellsOnDemand = sWorld->getBoolConfig(CONFIG_BASEMAP_LOAD_CELLS_ON_DEMAND) && !Instanceable();
 #ifdef ELUNA
     // lua state begins uninitialized
     eluna = nullptr;
@@ -559,12 +759,27 @@ bool Map::EnsureGridLoaded(Cell const& cell)
         loader.LoadN();
 
         Balance();
+        EnsureCellLoaded(cell);
         return true;
     }
 
+    EnsureCellLoaded(cell);
     return false;
 }
 
+void Map::EnsureCellLoaded(Cell const& cell)
+{
+    if (!_loadCellsOnDemand)
+        return;
+
+    NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
+    if (!grid || !grid->isGridObjectDataLoaded() || grid->isCellObjectDataLoaded(cell.CellX(), cell.CellY()))
+        return;
+
+    ObjectGridLoader loader(*grid, this, cell);
+    loader.LoadCell();
+}
+
 void Map::GridMarkNoUnload(uint32 x, uint32 y)
 {
     // First make sure this grid is loaded
@@ -728,7 +943,17 @@ bool Map::IsGridLoaded(GridCoord const& p) const
     return grid && grid->isGridObjectDataLoaded();
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+bool Map::IsCellLoaded(float x, float y) const
+{
+    Cell cell(x, y);
+    NGridType* grid = getNGrid(cell.GridX(), cell.GridY());
+    if (!grid || !grid->isGridObjectDataLoaded())
+        return false;
+
+    return !_loadCellsOnDemand || grid->isCellObjectDataLoaded(cell.CellX(), cell.CellY());
+}
+
+void Map::MarkNearbyCellsOf(WorldObject const* obj)
 {
     // Check for valid position
     if (!obj->IsPositionValid())
@@ -741,22 +966,54 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
     {
         for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
         {
-            // marked cells are those that have been visited
+            // marked cells are those that will be visited
             // don't visit the same cell twice
             uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (isCellMarked(cell_id))
-                continue;
+            if (!isCellMarked(cell_id))
+            {
+                markCell(cell_id);
 
-            markCell(cell_id);
-            CellCoord pair(x, y);
-            Cell cell(pair);
-            cell.SetNoCreate();
-            Visit(cell, gridVisitor);
-            Visit(cell, worldVisitor);
+                // cells of loaded grids get their spawns as soon as they come into range of an active object
+                if (_loadCellsOnDemand)
+                    EnsureCellLoaded(Cell(CellCoord(x, y)));
+            }
         }
     }
 }
 
+void Map::UpdateMarkedCells(uint32 diff)
+{
+    Trinity::ObjectUpdater updater(diff);
+    // for creature
+    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    // for pets
+    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+    // every cell once, no matter how many players and active objects share it
+    for (uint32 cell_id : _markedCellIds)
+    {
+        CellCoord pair(cell_id % TOTAL_NUMBER_OF_CELLS_PER_MAP, cell_id / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        Cell cell(pair);
+        cell.SetNoCreate();
+        Visit(cell, grid_object_update);
+        Visit(cell, world_object_update);
+    }
+
+    TC_METRIC_VALUE("map_updated_cells", uint64(_markedCellIds.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())));
+    TC_METRIC_VALUE("map_updated_objects", uint64(updater.i_updatedObjects),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())));
+}
+
+void Map::resetMarkedCells()
+{
+    // clearing only the marked bits is much cheaper than resetting the whole map bitset
+    for (uint32 cell_id : _markedCellIds)
+        marked_cells.reset(cell_id);
+
+    _markedCellIds.clear();
+}
+
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
@@ -772,9 +1029,59 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
     ++_zonePlayerCountMap[newZone];
 }
 
+void Map::SavePlayerInBatch(Player* player)
+{
+    // a failing statement rolls back the whole batch, keep it small enough to lose little
+    uint32 const batchSize = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_BATCH_SIZE);
+    if (batchSize && _batchedPlayerSaves.size() >= batchSize)
+        CommitPlayerSaves();
+
+    if (!_playerSaveTransaction)
+        _playerSaveTransaction = CharacterDatabase.BeginTransaction();
+
+    // SaveToDB may only reschedule itself (far teleport), such saves are not part of the batch
+    std::size_t const statements = _playerSaveTransaction->GetSize();
+    player->SaveToDB(_playerSaveTransaction);
+    if (_playerSaveTransaction->GetSize() != statements)
+        _batchedPlayerSaves.emplace_back(player->GetGUID(), player->GetSaveSequence());
+}
+
+void Map::CommitPlayerSaves()
+{
+    if (!_playerSaveTransaction)
+        return;
+
+    if (_batchedPlayerSaves.empty())
+    {
+        _playerSaveTransaction = nullptr;
+        return;
+    }
+
+    TC_METRIC_VALUE("player_save_batch_players", uint64(_batchedPlayerSaves.size()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())));
+    TC_METRIC_VALUE("player_save_batch_statements", uint64(_playerSaveTransaction->GetSize()),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())));
+
+    // sections the players skip while unchanged count as saved only after the batch made it to the database
+    _playerSaveCallbacks.AddCallback(CharacterDatabase.AsyncCommitTransaction(_playerSaveTransaction)).AfterComplete([this, savedPlayers = std::move(_batchedPlayerSaves)](bool success)
+    {
+        if (!success)
+            return;
+
+        for (auto const& [guid, saveSequence] : savedPlayers)
+            if (Player* player = ObjectAccessor::GetPlayer(this, guid))
+                player->ConfirmSave(saveSequence);
+    });
+
+    _playerSaveTransaction = nullptr;
+    _batchedPlayerSaves.clear();
+}
+
 void Map::Update(uint32 t_diff)
 {
     _dynamicTree.update(t_diff);
+    _playerSaveCallbacks.ProcessReadyCallbacks();
+
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -797,15 +1104,9 @@ void Map::Update(uint32 t_diff)
     else
         _respawnCheckTimer -= t_diff;
 
-    /// update active cells around players and active objects
+    /// collect active cells around players and active objects
     resetMarkedCells();
 
-    Trinity::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
-
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -818,11 +1119,11 @@ void Map::Update(uint32 t_diff)
         // update players at tick
         player->Update(t_diff);
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+        MarkNearbyCellsOf(player);
 
         // If player is using far sight or mind vision, visit that object too
         if (WorldObject* viewPoint = player->GetViewpoint())
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+            MarkNearbyCellsOf(viewPoint);
 
         // Handle updates for creatures in combat with player and are more than 60 yards away
         if (player->IsInCombat())
@@ -833,7 +1134,7 @@ void Map::Update(uint32 t_diff)
                     if (unit->GetMapId() == player->GetMapId() && !unit->IsWithinDistInMap(player, GetVisibilityRange(), false))
                         toVisit.push_back(unit);
             for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                MarkNearbyCellsOf(unit);
         }
 
         { // Update any creatures that own auras the player has applications of
@@ -845,7 +1146,7 @@ void Map::Update(uint32 t_diff)
                         toVisit.insert(caster);
             }
             for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                MarkNearbyCellsOf(unit);
         }
 
         { // Update player's summons
@@ -859,10 +1160,13 @@ void Map::Update(uint32 t_diff)
                             toVisit.push_back(unit);
 
             for (Unit* unit : toVisit)
-                VisitNearbyCellsOf(unit, grid_object_update, world_object_update);
+                MarkNearbyCellsOf(unit);
         }
     }
 
+    // flush autosaves right after the players, before anything else can save them again
+    CommitPlayerSaves();
+
     // non-player active objects, increasing iterator in the loop in case of object removal
     for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
     {
@@ -872,9 +1176,12 @@ void Map::Update(uint32 t_diff)
         if (!obj || !obj->IsInWorld())
             continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        MarkNearbyCellsOf(obj);
     }
 
+    /// update all objects in the collected cells
+    UpdateMarkedCells(t_diff);
+
     for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
     {
         WorldObject* obj = *_transportsUpdateIter;
@@ -921,6 +1228,19 @@ void Map::Update(uint32 t_diff)
     TC_METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         TC_METRIC_TAG("map_id", std::to_string(GetId())),
         TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _pathCorridorCache->LogMetrics();
+
+    TC_METRIC_VALUE("map_aura_updates", uint64(_tickingAuraUpdates),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())),
+        TC_METRIC_TAG("type", "ticking"));
+    TC_METRIC_VALUE("map_aura_updates", uint64(_idleAuraUpdates),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())),
+        TC_METRIC_TAG("type", "idle"));
+    _tickingAuraUpdates = 0;
+    _idleAuraUpdates = 0;
 }
 
 struct ResetNotifier
@@ -1728,6 +2048,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
             }
             VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(GetId(), gx, gy);
             MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(GetId(), gx, gy);
+            _pathCorridorCache->Clear();
         }
         else
             ((MapInstanced*)m_parentMap)->RemoveGridMapReference(GridCoord(gx, gy));
@@ -3018,8 +3339,40 @@ inline void Map::setNGrid(NGridType *grid, uint32 x, uint32 y)
     i_grids[x][y] = grid;
 }
 
+namespace
+{
+    // Shared between the map thread and the packet build helpers. Helpers may start only after the map
+    // thread is done (the pool is shared by all maps), so they keep the state alive and exit on finding no work.
+    struct ObjectUpdatePacketBuild
+    {
+        std::vector<std::pair<Player*, UpdateData*>> Receivers;
+        std::vector<WorldPacket> Packets;
+        std::atomic<std::size_t> NextReceiver = 0;
+        std::atomic<std::size_t> BuiltPackets = 0;
+
+        void Build()
+        {
+            for (std::size_t i = NextReceiver++; i < Receivers.size(); i = NextReceiver++)
+            {
+                Receivers[i].second->BuildPacket(&Packets[i]);
+                if (++BuiltPackets == Receivers.size())
+                    BuiltPackets.notify_all();
+            }
+        }
+
+        // only packets already claimed by a helper are left to wait for
+        void WaitForClaimedPackets()
+        {
+            for (std::size_t built = BuiltPackets; built != Receivers.size(); built = BuiltPackets)
+                BuiltPackets.wait(built);
+        }
+    };
+}
+
 void Map::SendObjectUpdates()
 {
+    TC_METRIC_TIMER("map_send_object_updates_time", TC_METRIC_TAG("map_id", std::to_string(GetId())));
+
     UpdateDataMapType update_players;
 
     while (!_updateObjects.empty())
@@ -3031,6 +3384,32 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players);
     }
 
+    // building and compressing the packets does not touch the map, so crowded maps hand it to the helper threads
+    Trinity::ThreadPool* pool = sMapMgr->GetPacketBuildPool();
+    if (pool && update_players.size() >= MIN_RECEIVERS_FOR_PARALLEL_PACKET_BUILD)
+    {
+        auto build = std::make_shared<ObjectUpdatePacketBuild>();
+        build->Receivers.reserve(update_players.size());
+        for (auto& [player, updateData] : update_players)
+            build->Receivers.emplace_back(player, &updateData);
+
+        build->Packets.resize(build->Receivers.size());
+
+        // the map thread takes part too and never waits for a helper that has not started
+        std::size_t helperCount = std::min<std::size_t>(sMapMgr->GetPacketBuildThreadCount(), build->Receivers.size() - 1);
+        for (std::size_t i = 0; i < helperCount; ++i)
+            pool->PostWork([build]() { build->Build(); });
+
+        build->Build();
+        build->WaitForClaimedPackets();
+
+        // one packet per receiver, sent in the same order as the serial path
+        for (std::size_t i = 0; i < build->Receivers.size(); ++i)
+            build->Receivers[i].first->SendDirectMessage(&build->Packets[i]);
+
+        return;
+    }
+
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
@@ -3118,7 +3497,7 @@ void Map::Respawn(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
     if (info->respawnTime <= GameTime::GetGameTime())
         return;
     info->respawnTime = GameTime::GetGameTime();
-    _respawnTimes->increase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    _respawnTimes->Reschedule(static_cast<RespawnInfoWithHandle*>(info));
     SaveRespawnInfoDB(*info, dbTrans);
 }
 
@@ -3173,7 +3552,7 @@ bool Map::AddRespawnInfo(RespawnInfo const& info)
         ABORT_MSG("Invalid respawn info for spawn id (%u,%u) being inserted", uint32(info.type), info.spawnId);
 
     RespawnInfoWithHandle* ri = new RespawnInfoWithHandle(info);
-    ri->handle = _respawnTimes->push(ri);
+    _respawnTimes->Insert(ri);
     bySpawnIdMap.emplace(ri->spawnId, ri);
     return true;
 }
@@ -3204,9 +3583,11 @@ RespawnInfo* Map::GetRespawnInfo(SpawnObjectType type, ObjectGuid::LowType spawn
 
 void Map::UnloadAllRespawnInfos() // delete everything from memory
 {
-    for (RespawnInfo* info : *_respawnTimes)
-        delete info;
-    _respawnTimes->clear();
+    _respawnTimes->Clear();
+    for (RespawnInfoMap::value_type const& pair : _creatureRespawnTimesBySpawnId)
+        delete pair.second;
+    for (RespawnInfoMap::value_type const& pair : _gameObjectRespawnTimesBySpawnId)
+        delete pair.second;
     _creatureRespawnTimesBySpawnId.clear();
     _gameObjectRespawnTimesBySpawnId.clear();
 }
@@ -3223,8 +3604,8 @@ void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTr
     ASSERT(it != range.second, "Respawn stores inconsistent for map %u, spawnid %u (type %u)", GetId(), info->spawnId, uint32(info->type));
     spawnMap.erase(it);
 
-    // respawn heap
-    _respawnTimes->erase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    // respawn queue
+    _respawnTimes->Remove(static_cast<RespawnInfoWithHandle*>(info));
 
     // database
     DeleteRespawnInfoFromDB(info->type, info->spawnId, dbTrans);
@@ -3240,7 +3621,7 @@ void Map::DeleteRespawnInfoFromDB(SpawnObjectType type, ObjectGuid::LowType spaw
     stmt->setUInt32(1, spawnId);
     stmt->setUInt16(2, GetId());
     stmt->setUInt32(3, GetInstanceId());
-    CharacterDatabase.ExecuteOrAppend(dbTrans, stmt);
+    CharacterDatabase.ExecuteOrAppend(dbTrans ? dbTrans : _respawnDbTrans, stmt);
 }
 
 void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gridId)
@@ -3248,6 +3629,12 @@ void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gr
     if (!IsGridLoaded(gridId)) // if grid isn't loaded, this will be processed in grid load handler
         return;
 
+    // same for cells that are loaded on demand
+    if (_loadCellsOnDemand)
+        if (SpawnData const* data = sObjectMgr->GetSpawnData(type, spawnId))
+            if (!IsCellLoaded(data->spawnPoint))
+                return;
+
     switch (type)
     {
         case SPAWN_TYPE_CREATURE:
@@ -3272,16 +3659,16 @@ void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gr
 void Map::ProcessRespawns()
 {
     time_t now = GameTime::GetGameTime();
-    while (!_respawnTimes->empty())
-    {
-        RespawnInfoWithHandle* next = _respawnTimes->top();
-        if (now < next->respawnTime) // done for this tick
-            break;
 
+    // all respawn time changes of this pass go to the database in one transaction
+    _respawnDbTrans = CharacterDatabase.BeginTransaction();
+
+    while (RespawnInfoWithHandle* next = _respawnTimes->GetNextDue(now))
+    {
         if (uint32 poolId = sPoolMgr->IsPartOfAPool(next->type, next->spawnId)) // is this part of a pool?
         { // if yes, respawn will be handled by (external) pooling logic, just delete the respawn time
             // step 1: remove entry from maps to avoid it being reachable by outside logic
-            _respawnTimes->pop();
+            _respawnTimes->Remove(next);
             GetRespawnMapForType(next->type).erase(next->spawnId);
 
             // step 2: tell pooling logic to do its thing
@@ -3294,7 +3681,7 @@ void Map::ProcessRespawns()
         else if (CheckRespawn(next)) // see if we're allowed to respawn
         { // ok, respawn
             // step 1: remove entry from maps to avoid it being reachable by outside logic
-            _respawnTimes->pop();
+            _respawnTimes->Remove(next);
             GetRespawnMapForType(next->type).erase(next->spawnId);
 
             // step 2: do the respawn, which involves external logic
@@ -3306,18 +3693,22 @@ void Map::ProcessRespawns()
         }
         else if (!next->respawnTime)
         { // just remove this respawn entry without rescheduling
-            _respawnTimes->pop();
+            _respawnTimes->Remove(next);
             GetRespawnMapForType(next->type).erase(next->spawnId);
             RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
             delete next;
         }
         else
-        { // new respawn time, update heap position
+        { // new respawn time, move it back into the wheel
             ASSERT(now < next->respawnTime); // infinite loop guard
-            _respawnTimes->decrease(next->handle);
+            _respawnTimes->Reschedule(next);
             SaveRespawnInfoDB(*next);
         }
     }
+
+    if (_respawnDbTrans->GetSize())
+        CharacterDatabase.CommitTransaction(_respawnDbTrans);
+    _respawnDbTrans = nullptr;
 }
 
 void Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay, uint32 mode) const
@@ -3433,8 +3824,8 @@ bool Map::SpawnGroupSpawn(uint32 groupId, bool ignoreRespawn, bool force, std::v
         if (!(data->spawnMask & (1 << GetSpawnMode())))
             continue;
 
-        // don't spawn if the grid isn't loaded (will be handled in grid loader)
-        if (!IsGridLoaded(data->spawnPoint))
+        // don't spawn if the grid or cell isn't loaded (will be handled in grid loader)
+        if (!IsCellLoaded(data->spawnPoint))
             continue;
 
         // now do the actual (re)spawn
@@ -4534,7 +4925,7 @@ void Map::SaveRespawnInfoDB(RespawnInfo const& info, CharacterDatabaseTransactio
     stmt->setUInt64(2, uint64(info.respawnTime));
     stmt->setUInt16(3, GetId());
     stmt->setUInt32(4, GetInstanceId());
-    CharacterDatabase.ExecuteOrAppend(dbTrans, stmt);
+    CharacterDatabase.ExecuteOrAppend(dbTrans ? dbTrans : _respawnDbTrans, stmt);
 }
 
 void Map::LoadRespawnTimes()
@@ -19,6 +19,7 @@
 #define TRINITY_MAP_H
 
 #include "Define.h"
+#include "AsyncCallbackProcessor.h"
 
 #include "Cell.h"
 #include "DynamicTree.h"
@@ -55,6 +56,7 @@ class InstanceSave;
 class InstanceScript;
 class MapInstanced;
 class Object;
+class PathCorridorCache;
 class Player;
 class TempSummon;
 class Transport;
@@ -311,7 +313,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         template<class T> bool AddToMap(T *);
         template<class T> void RemoveFromMap(T *, bool);
 
-        void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<Trinity::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
+        void MarkNearbyCellsOf(WorldObject const* obj);
+        void UpdateMarkedCells(uint32 diff);
         virtual void Update(uint32);
 
         float GetVisibilityRange() const { return m_VisibleDistance; }
@@ -337,6 +340,11 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         bool IsGridLoaded(float x, float y) const { return IsGridLoaded(Trinity::ComputeGridCoord(x, y)); }
         bool IsGridLoaded(Position const& pos) const { return IsGridLoaded(pos.GetPositionX(), pos.GetPositionY()); }
 
+        // whether spawns placed at this position would already exist, see BaseMapLoadCellsOnDemand
+        bool IsLoadingCellsOnDemand() const { return _loadCellsOnDemand; }
+        bool IsCellLoaded(float x, float y) const;
+        bool IsCellLoaded(Position const& pos) const { return IsCellLoaded(pos.GetPositionX(), pos.GetPositionY()); }
+
         bool GetUnloadLock(GridCoord const& p) const { return getNGrid(p.x_coord, p.y_coord)->getUnloadLock(); }
         void SetUnloadLock(GridCoord const& p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadExplicitLock(on); }
         void LoadGrid(float x, float y);
@@ -436,9 +444,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void AddObjectToSwitchList(WorldObject* obj, bool on);
         virtual void DelayedUpdate(uint32 diff);
 
-        void resetMarkedCells() { marked_cells.reset(); }
+        void resetMarkedCells();
         bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
-        void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
+        void markCell(uint32 pCellId) { marked_cells.set(pCellId); _markedCellIds.push_back(pCellId); }
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
@@ -494,6 +502,11 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         MapStoredObjectTypesContainer& GetObjectsStore() { return _objectsStore; }
 
+        PathCorridorCache& GetPathCorridorCache() { return *_pathCorridorCache; }
+
+        // per update totals of owned aura updates, reported as the map_aura_updates metric
+        void AddAuraUpdates(std::size_t ticking, std::size_t idle) { _tickingAuraUpdates += ticking; _idleAuraUpdates += idle; }
+
         typedef std::unordered_multimap<ObjectGuid::LowType, Creature*> CreatureBySpawnIdContainer;
         CreatureBySpawnIdContainer& GetCreatureBySpawnIdStore() { return _creatureBySpawnIdStore; }
         CreatureBySpawnIdContainer const& GetCreatureBySpawnIdStore() const { return _creatureBySpawnIdStore; }
@@ -562,6 +575,10 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         void UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone);
 
+        // Autosaves of the players on the map are collected into transactions of up to PlayerSave.BatchSize players per update
+        void SavePlayerInBatch(Player* player);
+        void CommitPlayerSaves();
+
         void SaveRespawnTime(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 entry, time_t respawnTime, uint32 gridId, CharacterDatabaseTransaction dbTrans = nullptr, bool startup = false);
         void SaveRespawnInfoDB(RespawnInfo const& info, CharacterDatabaseTransaction dbTrans = nullptr);
         void LoadRespawnTimes();
@@ -657,6 +674,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void EnsureGridCreated_i(GridCoord const&);
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedForActiveObject(Cell const&, WorldObject* object);
+        void EnsureCellLoaded(Cell const&);
 
         void buildNGridLinkage(NGridType* pNGridType) { pNGridType->link(this); }
 
@@ -711,6 +729,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         GameObject* _FindGameObject(WorldObject* pWorldObject, ObjectGuid::LowType guid) const;
 
         time_t i_gridExpiry;
+        bool _loadCellsOnDemand;
 
         //used for fast base_map (e.g. MapInstanced class object) search for
         //InstanceMaps and BattlegroundMaps...
@@ -719,6 +738,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         GridMap* GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        std::vector<uint32> _markedCellIds;                 // the set bits of marked_cells, in marking order
 
         //these functions used to process player/mob aggro reactions and
         //visibility calculations. Highly optimized for massive calculations
@@ -822,6 +842,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         }
 
         std::unique_ptr<RespawnListContainer> _respawnTimes;
+        CharacterDatabaseTransaction _respawnDbTrans;      // open while ProcessRespawns runs, collects its respawn time changes
         RespawnInfoMap       _creatureRespawnTimesBySpawnId;
         RespawnInfoMap       _gameObjectRespawnTimesBySpawnId;
         RespawnInfoMap& GetRespawnMapForType(SpawnObjectType type)
@@ -855,6 +876,15 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         uint32 _respawnCheckTimer;
         std::unordered_map<uint32, uint32> _zonePlayerCountMap;
 
+        CharacterDatabaseTransaction _playerSaveTransaction;
+        std::vector<std::pair<ObjectGuid, uint32>> _batchedPlayerSaves; // player, Player::GetSaveSequence() of the batched save
+        AsyncCallbackProcessor<TransactionCallback> _playerSaveCallbacks;
+
+        std::unique_ptr<PathCorridorCache> _pathCorridorCache;
+
+        std::size_t _tickingAuraUpdates;
+        std::size_t _idleAuraUpdates;
+
         ZoneDynamicInfoMap _zoneDynamicInfo;
         IntervalTimer _weatherUpdateTimer;
 
@@ -34,13 +34,14 @@
 #include "WorldSession.h"
 #include "Opcodes.h"
 #include "ScriptMgr.h"
+#include "ThreadPool.h"
 #include <numeric>
 #ifdef ELUNA
 #include "LuaEngine.h"
 #endif
 
 MapManager::MapManager()
-    : _nextInstanceId(0), _scheduledScripts(0)
+    : _nextInstanceId(0), _packetBuildThreads(0), _scheduledScripts(0)
 {
     i_gridCleanUpDelay = sWorld->getIntConfig(CONFIG_INTERVAL_GRIDCLEAN);
     i_timer.SetInterval(sWorld->getIntConfig(CONFIG_INTERVAL_MAPUPDATE));
@@ -56,6 +57,10 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    _packetBuildThreads = sWorld->getIntConfig(CONFIG_MAP_UPDATE_PACKET_BUILD_THREADS);
+    if (_packetBuildThreads > 0)
+        _packetBuildPool = std::make_unique<Trinity::ThreadPool>(_packetBuildThreads);
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -281,6 +286,12 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    if (_packetBuildPool)
+    {
+        _packetBuildPool->Join();
+        _packetBuildPool.reset();
+    }
+
     Map::DeleteStateMachine();
 }
 
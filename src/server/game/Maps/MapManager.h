@@ -26,6 +26,11 @@
 #include "UniqueTrackablePtr.h"
 #include <boost/dynamic_bitset.hpp>
 
+namespace Trinity
+{
+    class ThreadPool;
+}
+
 class Transport;
 struct TransportCreatureProto;
 
@@ -129,6 +134,10 @@ class TC_GAME_API MapManager
 
         MapUpdater * GetMapUpdater() { return &m_updater; }
 
+        // helper threads for Map::SendObjectUpdates, null when disabled
+        Trinity::ThreadPool* GetPacketBuildPool() { return _packetBuildPool.get(); }
+        uint32 GetPacketBuildThreadCount() const { return _packetBuildThreads; }
+
         template<typename Worker>
         void DoForAllMaps(Worker&& worker);
 
@@ -165,6 +174,9 @@ class TC_GAME_API MapManager
         uint32 _nextInstanceId;
         MapUpdater m_updater;
 
+        std::unique_ptr<Trinity::ThreadPool> _packetBuildPool;
+        uint32 _packetBuildThreads;
+
         // atomic op counter for active scripts amount
         std::atomic<std::size_t> _scheduledScripts;
 };
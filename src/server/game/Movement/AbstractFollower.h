@@ -24,7 +24,7 @@ struct AbstractFollower
 {
     public:
         AbstractFollower(Unit* target = nullptr) { SetTarget(target); }
-        ~AbstractFollower() { SetTarget(nullptr); }
+        virtual ~AbstractFollower() { SetTarget(nullptr); }
 
         void SetTarget(Unit* unit);
         Unit* GetTarget() const { return _target; }
@@ -19,12 +19,14 @@
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "G3DPosition.hpp"
+#include "GameTime.h"
 #include "MotionMaster.h"
 #include "MoveSpline.h"
 #include "MoveSplineInit.h"
 #include "PathGenerator.h"
 #include "Unit.h"
 #include "Util.h"
+#include "World.h"
 
 static bool HasLostTarget(Unit* owner, Unit* target)
 {
@@ -82,6 +84,8 @@ void ChaseMovementGenerator::Initialize(Unit* /*owner*/)
 
     _path = nullptr;
     _lastTargetPosition.reset();
+    _pathTargetPosition.reset();
+    _crowdAngle.reset();
 }
 
 void ChaseMovementGenerator::Reset(Unit* owner)
@@ -169,15 +173,36 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
 
             // figure out which way we want to move
             bool const moveToward = !owner->IsInDist(target, maxRange);
+            bool const crowdSteering = cOwner && moveToward && !angle && sWorld->getBoolConfig(CONFIG_CHASE_CROWD_STEERING);
+
+            // we are still on our way and the target barely moved since our path was made, keep following it
+            // and look again next update, once the path is done a new one is made if we are not in range
+            if (crowdSteering && owner->HasUnitState(UNIT_STATE_CHASE_MOVE) && !owner->movespline->Finalized() && _pathTargetPosition &&
+                target->GetExactDist(*_pathTargetPosition) < std::max(CROWD_REPATH_DISTANCE, owner->GetExactDist(target) * CROWD_REPATH_FACTOR))
+            {
+                _lastTargetPosition.reset();
+                return true;
+            }
 
             // make a new path if we have to...
             if (!_path || moveToward != _movingTowards)
+            {
                 _path = std::make_unique<PathGenerator>(owner);
+                if (crowdSteering)
+                    ShareCrowdCorridor(target);
+            }
 
             float x, y, z;
             bool shortenPath;
+            if (crowdSteering)
+            {
+                // ...with others chasing the same target, we take our own spot around it
+                _crowdAngle = SelectCrowdAngle(owner, target, maxTarget);
+                target->GetNearPoint(owner, x, y, z, maxTarget - hitboxSum, *_crowdAngle);
+                shortenPath = false;
+            }
             // if we want to move toward the target and there's no fixed angle...
-            if (moveToward && !angle)
+            else if (moveToward && !angle)
             {
                 // ...we'll pathfind to the center, then shorten the path
                 target->GetPosition(x, y, z);
@@ -205,6 +230,9 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
             if (shortenPath)
                 _path->ShortenPathUntilDist(PositionToVector3(target), maxTarget);
 
+            _pathTargetPosition = target->GetPosition();
+            _pathTime = GameTime::GetGameTimeMS();
+
             if (cOwner)
                 cOwner->SetCannotReachTarget(false);
 
@@ -239,8 +267,55 @@ bool ChaseMovementGenerator::Update(Unit* owner, uint32 diff)
     return true;
 }
 
+void ChaseMovementGenerator::ShareCrowdCorridor(Unit* target)
+{
+    uint32 now = GameTime::GetGameTimeMS();
+    for (AbstractFollower* follower : target->GetFollowers())
+    {
+        ChaseMovementGenerator const* chase = dynamic_cast<ChaseMovementGenerator const*>(follower);
+        if (!chase || chase == this || !chase->_path || getMSTimeDiff(chase->_pathTime, now) > CROWD_CORRIDOR_SHARE_TIME)
+            continue;
+
+        _path->ShareCorridor(*chase->_path);
+        return;
+    }
+}
+
+float ChaseMovementGenerator::SelectCrowdAngle(Unit* owner, Unit* target, float ringRadius) const
+{
+    std::vector<float> takenAngles;
+    for (AbstractFollower* follower : target->GetFollowers())
+        if (ChaseMovementGenerator const* chase = dynamic_cast<ChaseMovementGenerator const*>(follower))
+            if (chase != this && chase->_crowdAngle)
+                takenAngles.push_back(*chase->_crowdAngle);
+
+    // the angle our hitbox covers on the circle around the target we stop at
+    float const separation = std::clamp(2.0f * owner->GetCombatReach() / std::max(ringRadius, 0.1f), 0.1f, float(M_PI) / 4);
+    auto isFree = [&](float angle)
+    {
+        return std::none_of(takenAngles.begin(), takenAngles.end(), [&](float taken)
+        {
+            float const diff = Position::NormalizeOrientation(angle - taken);
+            return std::min(diff, float(2 * M_PI) - diff) < separation;
+        });
+    };
+
+    // closest free spot on our side of the target, stack with the others if there is none
+    float const desired = target->GetAbsoluteAngle(owner);
+    for (uint32 step = 0; step * separation <= float(M_PI) / 2; ++step)
+    {
+        if (isFree(desired + step * separation))
+            return Position::NormalizeOrientation(desired + step * separation);
+        if (step && isFree(desired - step * separation))
+            return Position::NormalizeOrientation(desired - step * separation);
+    }
+
+    return desired;
+}
+
 void ChaseMovementGenerator::Deactivate(Unit* owner)
 {
+    _crowdAngle.reset();
     AddFlag(MOVEMENTGENERATOR_FLAG_DEACTIVATED);
     RemoveFlag(MOVEMENTGENERATOR_FLAG_TRANSITORY | MOVEMENTGENERATOR_FLAG_INFORM_ENABLED);
     owner->ClearUnitState(UNIT_STATE_CHASE_MOVE);
@@ -251,6 +326,7 @@ void ChaseMovementGenerator::Deactivate(Unit* owner)
 void ChaseMovementGenerator::Finalize(Unit* owner, bool active, bool/* movementInform*/)
 {
     AddFlag(MOVEMENTGENERATOR_FLAG_FINALIZED);
+    _crowdAngle.reset();
     if (active)
     {
         owner->ClearUnitState(UNIT_STATE_CHASE_MOVE);
@@ -45,12 +45,21 @@ class ChaseMovementGenerator : public MovementGenerator, public AbstractFollower
 
     private:
         static constexpr uint32 RANGE_CHECK_INTERVAL = 100; // time (ms) until we attempt to recalculate
+        static constexpr uint32 CROWD_CORRIDOR_SHARE_TIME = 1000; // time (ms) our path corridor is offered to others chasing the same target
+        static constexpr float CROWD_REPATH_DISTANCE = 2.0f; // target movement (yards) ignored while we are still moving along our path
+        static constexpr float CROWD_REPATH_FACTOR = 0.25f; // same, as a fraction of our distance to the target
+
+        void ShareCrowdCorridor(Unit* target);
+        float SelectCrowdAngle(Unit* owner, Unit* target, float ringRadius) const;
 
         Optional<ChaseRange> const _range;
         Optional<ChaseAngle> const _angle;
 
         std::unique_ptr<PathGenerator> _path;
         Optional<Position> _lastTargetPosition;
+        Optional<Position> _pathTargetPosition; // where the target was when _path was calculated
+        Optional<float> _crowdAngle;            // absolute angle around the target we are heading to, with crowd steering
+        uint32 _pathTime = 0;
         TimeTracker _rangeCheckTimer;
         bool _movingTowards = true;
         bool _mutualChase = true;
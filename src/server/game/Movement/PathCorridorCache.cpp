@@ -0,0 +1,134 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCorridorCache.h"
+#include "DetourNavMeshQuery.h"
+#include "GameTime.h"
+#include "Metric.h"
+#include "Timer.h"
+#include "World.h"
+
+// more than enough for every chaser of a big battle, bounds memory when paths never repeat
+static constexpr std::size_t MAX_CACHED_CORRIDORS = 2048;
+
+PathCorridorCache::PathCorridorCache(uint32 mapId, uint32 instanceId) : _mapId(mapId), _instanceId(instanceId),
+    _requests(0), _hits(0), _searches(0), _searchTime(0)
+{
+}
+
+std::size_t PathCorridorCache::CorridorKeyHash::operator()(CorridorKey const& key) const
+{
+    std::size_t hash = std::hash<dtPolyRef>()(key.StartPoly);
+    hash ^= std::hash<dtPolyRef>()(key.EndPoly) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= (std::size_t(key.IncludeFlags) << 16 | key.ExcludeFlags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+PathCorridorCache::CorridorKey PathCorridorCache::MakeKey(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter)
+{
+    return { startPoly, endPoly, filter.getIncludeFlags(), filter.getExcludeFlags() };
+}
+
+uint32 PathCorridorCache::Find(dtNavMesh const* navMesh, dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter, dtPolyRef* path, uint32 maxPathSize)
+{
+    ++_requests;
+
+    uint32 cacheTime = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_TIME);
+    if (!cacheTime)
+        return 0;
+
+    auto itr = _corridors.find(MakeKey(startPoly, endPoly, filter));
+    if (itr == _corridors.end())
+        return 0;
+
+    Corridor const& corridor = itr->second;
+    if (getMSTimeDiff(corridor.StoreTime, GameTime::GetGameTimeMS()) > cacheTime || corridor.Polygons.size() > maxPathSize)
+    {
+        _corridors.erase(itr);
+        return 0;
+    }
+
+    // tiles shared with other instances of the map may have been reloaded in the meantime
+    for (dtPolyRef polyRef : corridor.Polygons)
+    {
+        if (!navMesh->isValidPolyRef(polyRef))
+        {
+            _corridors.erase(itr);
+            return 0;
+        }
+    }
+
+    std::copy(corridor.Polygons.begin(), corridor.Polygons.end(), path);
+    ++_hits;
+    return uint32(corridor.Polygons.size());
+}
+
+void PathCorridorCache::Store(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter, dtPolyRef const* path, uint32 pathSize)
+{
+    uint32 cacheTime = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_TIME);
+    if (!cacheTime || !pathSize)
+        return;
+
+    uint32 now = GameTime::GetGameTimeMS();
+    if (_corridors.size() >= MAX_CACHED_CORRIDORS)
+    {
+        for (auto itr = _corridors.begin(); itr != _corridors.end();)
+        {
+            if (getMSTimeDiff(itr->second.StoreTime, now) > cacheTime)
+                itr = _corridors.erase(itr);
+            else
+                ++itr;
+        }
+
+        if (_corridors.size() >= MAX_CACHED_CORRIDORS)
+            _corridors.clear();
+    }
+
+    Corridor& corridor = _corridors[MakeKey(startPoly, endPoly, filter)];
+    corridor.Polygons.assign(path, path + pathSize);
+    corridor.StoreTime = now;
+}
+
+void PathCorridorCache::RecordSearch(std::chrono::microseconds searchTime)
+{
+    ++_searches;
+    _searchTime += searchTime;
+}
+
+void PathCorridorCache::LogMetrics()
+{
+    if (!_requests)
+        return;
+
+    TC_METRIC_VALUE("path_requests", uint64(_requests),
+        TC_METRIC_TAG("map_id", std::to_string(_mapId)),
+        TC_METRIC_TAG("map_instanceid", std::to_string(_instanceId)));
+    TC_METRIC_VALUE("path_cache_hits", uint64(_hits),
+        TC_METRIC_TAG("map_id", std::to_string(_mapId)),
+        TC_METRIC_TAG("map_instanceid", std::to_string(_instanceId)));
+    TC_METRIC_VALUE("path_searches", uint64(_searches),
+        TC_METRIC_TAG("map_id", std::to_string(_mapId)),
+        TC_METRIC_TAG("map_instanceid", std::to_string(_instanceId)));
+    TC_METRIC_VALUE("path_search_time", uint64(_searchTime.count()),
+        TC_METRIC_TAG("map_id", std::to_string(_mapId)),
+        TC_METRIC_TAG("map_instanceid", std::to_string(_instanceId)));
+
+    _requests = 0;
+    _hits = 0;
+    _searches = 0;
+    _searchTime = std::chrono::microseconds::zero();
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_PATHCORRIDORCACHE_H
+#define TRINITY_PATHCORRIDORCACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+class dtQueryFilter;
+
+// Remembers the polygon corridors found by dtNavMeshQuery::findPath on one map, so that many
+// units pathing between the same start and end polygons in a short time (a group chasing the
+// same target, adds running to the same spot) share a single search.
+// Only used from the thread updating the owning map.
+class TC_GAME_API PathCorridorCache
+{
+    public:
+        PathCorridorCache(uint32 mapId, uint32 instanceId);
+
+        PathCorridorCache(PathCorridorCache const&) = delete;
+        PathCorridorCache& operator=(PathCorridorCache const&) = delete;
+
+        // copies a cached corridor into path and returns its length, 0 if nothing usable is cached
+        uint32 Find(dtNavMesh const* navMesh, dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter, dtPolyRef* path, uint32 maxPathSize);
+        void Store(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter, dtPolyRef const* path, uint32 pathSize);
+
+        // must be called whenever navmesh tiles of the map are loaded or unloaded
+        void Clear() { _corridors.clear(); }
+
+        // called once for every Find that returned 0 and was followed by a full findPath, so path_requests = hits + searches
+        void RecordSearch(std::chrono::microseconds searchTime);
+        void LogMetrics();
+
+    private:
+        struct CorridorKey
+        {
+            dtPolyRef StartPoly;
+            dtPolyRef EndPoly;
+            uint16 IncludeFlags;
+            uint16 ExcludeFlags;
+
+            bool operator==(CorridorKey const& right) const = default;
+        };
+
+        struct CorridorKeyHash
+        {
+            std::size_t operator()(CorridorKey const& key) const;
+        };
+
+        struct Corridor
+        {
+            std::vector<dtPolyRef> Polygons;
+            uint32 StoreTime;
+        };
+
+        static CorridorKey MakeKey(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter);
+
+        uint32 _mapId;
+        uint32 _instanceId;
+        std::unordered_map<CorridorKey, Corridor, CorridorKeyHash> _corridors;
+
+        // counters since the last LogMetrics call
+        uint32 _requests;
+        uint32 _hits;
+        uint32 _searches;
+        std::chrono::microseconds _searchTime;
+};
+
+#endif // TRINITY_PATHCORRIDORCACHE_H
@@ -25,6 +25,7 @@
 #include "DetourCommon.h"
 #include "DetourNavMeshQuery.h"
 #include "Metric.h"
+#include "PathCorridorCache.h"
 
 ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
@@ -90,6 +91,15 @@ bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool fo
     return true;
 }
 
+void PathGenerator::ShareCorridor(PathGenerator const& other)
+{
+    if (!_navMeshQuery || _navMeshQuery != other._navMeshQuery || _useRaycast || !other._polyLength)
+        return;
+
+    memcpy(_pathPolyRefs, other._pathPolyRefs, other._polyLength * sizeof(dtPolyRef));
+    _polyLength = other._polyLength;
+}
+
 dtPolyRef PathGenerator::GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -493,15 +503,41 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
+            // units of the same map often path between the same polygons in a short time, reuse their corridor
+            PathCorridorCache* corridorCache = nullptr;
+            if (Map* map = _source->FindMap())
+                corridorCache = &map->GetPathCorridorCache();
+
+            _polyLength = corridorCache ? corridorCache->Find(_navMesh, startPoly, endPoly, _filter, _pathPolyRefs, MAX_PATH_LENGTH) : 0;
+            if (_polyLength)
+                dtResult = DT_SUCCESS;
+            else
+            {
+                TimePoint searchStart = std::chrono::steady_clock::now();
+
+                dtResult = _navMeshQuery->findPath(
+                                startPoly,          // start polygon
+                                endPoly,            // end polygon
+                                startPoint,         // start position
+                                endPoint,           // end position
+                                &_filter,           // polygon search filter
+                                _pathPolyRefs,     // [out] path
+                                (int*)&_polyLength,
+                                MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                if (corridorCache)
+                {
+                    corridorCache->RecordSearch(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - searchStart));
+
+                    // partial corridors depend on where the search gave up, only share complete ones
+                    if (dtStatusSucceed(dtResult) && !dtStatusDetail(dtResult, DT_PARTIAL_RESULT) && _polyLength && _pathPolyRefs[_polyLength - 1] == endPoly)
+                        corridorCache->Store(startPoly, endPoly, _filter, _pathPolyRefs, _polyLength);
+                }
+
+                // the search gave up before reaching the end, follow the coarse route over the navmesh tiles instead
+                if (dtStatusSucceed(dtResult) && dtStatusDetail(dtResult, DT_OUT_OF_NODES | DT_BUFFER_TOO_SMALL))
+                    BuildTileRoutePolyPath(startPoly, endPoly, startPoint, endPoint);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -526,6 +562,73 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     BuildPointPath(startPoint, endPoint);
 }
 
+bool PathGenerator::BuildTileRoutePolyPath(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint)
+{
+    MMAP::TileRoute route;
+    if (!MMAP::MMapFactory::createOrGetMMapManager()->FindTileRoute(_source->GetMapId(), startPoint, endPoint, route))
+        return false;
+
+    route.push_back({ endPoint[0], endPoint[1], endPoint[2] });
+
+    dtPolyRef path[MAX_PATH_LENGTH];
+    path[0] = startPoly;
+    uint32 pathLength = 1;
+
+    dtPolyRef currentPoly = startPoly;
+    float currentPoint[VERTEX_SIZE];
+    dtVcopy(currentPoint, startPoint);
+
+    // refine the route one portal at a time, as far as the corridor size allows
+    for (std::size_t i = 0; i < route.size() && pathLength < MAX_PATH_LENGTH; ++i)
+    {
+        float const* waypoint = route[i].data();
+        dtPolyRef waypointPoly = endPoly;
+        if (i + 1 < route.size())
+        {
+            float extents[VERTEX_SIZE] = { 3.0f, 5.0f, 3.0f };
+            if (dtStatusFailed(_navMeshQuery->findNearestPoly(waypoint, extents, &_filter, &waypointPoly, nullptr)) || waypointPoly == INVALID_POLYREF)
+                break;
+        }
+
+        if (waypointPoly == currentPoly)
+            continue;
+
+        uint32 segmentLength = 0;
+        dtStatus result = _navMeshQuery->findPath(currentPoly, waypointPoly, currentPoint, waypoint, &_filter,
+            path + pathLength - 1, (int*)&segmentLength, MAX_PATH_LENGTH - pathLength + 1);
+        if (dtStatusFailed(result) || !segmentLength)
+            break;
+
+        // the segment starts on the last polygon of the corridor, drop any loop it makes back into the corridor
+        uint32 newPathLength = pathLength + segmentLength - 1;
+        for (uint32 j = pathLength; j < newPathLength; ++j)
+        {
+            dtPolyRef* loopStart = std::find(path, path + j, path[j]);
+            if (loopStart != path + j)
+            {
+                uint32 removed = uint32(path + j - loopStart);
+                memmove(loopStart, path + j, (newPathLength - j) * sizeof(dtPolyRef));
+                newPathLength -= removed;
+                j -= removed;
+            }
+        }
+
+        pathLength = newPathLength;
+        if (path[pathLength - 1] != waypointPoly)
+            break;
+
+        currentPoly = waypointPoly;
+        dtVcopy(currentPoint, waypoint);
+    }
+
+    if (pathLength <= 1)
+        return false;
+
+    memcpy(_pathPolyRefs, path, pathLength * sizeof(dtPolyRef));
+    _polyLength = pathLength;
+    return true;
+}
+
 void PathGenerator::BuildPointPath(const float *startPoint, const float *endPoint)
 {
     float pathPoints[MAX_POINT_PATH_LENGTH*VERTEX_SIZE];
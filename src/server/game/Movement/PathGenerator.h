@@ -69,6 +69,10 @@ class TC_GAME_API PathGenerator
         void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH); }
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
 
+        // starts from the polygon corridor of another path on the same map, the next CalculatePath
+        // then only cuts its part out of it when the start and end lie on that corridor
+        void ShareCorridor(PathGenerator const& other);
+
         // result getters
         G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
         G3D::Vector3 const& GetEndPosition() const { return _endPosition; }
@@ -124,6 +128,7 @@ class TC_GAME_API PathGenerator
         bool HaveTile(G3D::Vector3 const& p) const;
 
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
+        bool BuildTileRoutePolyPath(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint);
         void BuildPointPath(float const* startPoint, float const* endPoint);
         void BuildShortcut();
 
@@ -328,7 +328,7 @@ void PoolGroup<Creature>::Spawn1Object(PoolObject* obj)
         // Spawn if necessary (loaded grids only)
         Map* map = sMapMgr->CreateBaseMap(data->mapId);
         // We use spawn coords to spawn
-        if (!map->Instanceable() && map->IsGridLoaded(data->spawnPoint))
+        if (!map->Instanceable() && map->IsCellLoaded(data->spawnPoint))
         {
             Creature* creature = new Creature();
             //TC_LOG_DEBUG("pool", "Spawning creature {}", guid);
@@ -352,7 +352,7 @@ void PoolGroup<GameObject>::Spawn1Object(PoolObject* obj)
         // this base map checked as non-instanced and then only existed
         Map* map = sMapMgr->CreateBaseMap(data->mapId);
         // We use current coords to unspawn, not spawn coords since creature can have changed grid
-        if (!map->Instanceable() && map->IsGridLoaded(data->spawnPoint))
+        if (!map->Instanceable() && map->IsCellLoaded(data->spawnPoint))
         {
             GameObject* pGameobject = new GameObject;
             //TC_LOG_DEBUG("pool", "Spawning gameobject {}", guid);
@@ -67,8 +67,25 @@ WorldPacket const* WorldPackets::Guild::GuildRoster::Write()
     for (GuildRankData const& rank : RankData)
         _worldPacket << rank;
 
+    MemberLevelPositions.clear();
+    MemberLevelPositions.reserve(MemberData.size());
     for (GuildRosterMemberData const& member : MemberData)
-        _worldPacket << member;
+    {
+        _worldPacket << member.Guid;
+        _worldPacket << uint8(member.Status);
+        _worldPacket << member.Name;
+        _worldPacket << int32(member.RankID);
+        MemberLevelPositions.push_back(_worldPacket.wpos());
+        _worldPacket << uint8(member.Level);
+        _worldPacket << uint8(member.ClassID);
+        _worldPacket << uint8(member.Gender);
+        _worldPacket << int32(member.AreaID);
+        if (!member.Status)
+            _worldPacket << float(member.LastSave);
+
+        _worldPacket << member.Note;
+        _worldPacket << member.OfficerNote;
+    }
 
     return &_worldPacket;
 }
@@ -100,25 +117,6 @@ WorldPacket const* WorldPackets::Guild::GuildInvite::Write()
     return &_worldPacket;
 }
 
-ByteBuffer& operator<<(ByteBuffer& data, WorldPackets::Guild::GuildRosterMemberData const& rosterMemberData)
-{
-    data << rosterMemberData.Guid;
-    data << uint8(rosterMemberData.Status);
-    data << rosterMemberData.Name;
-    data << int32(rosterMemberData.RankID);
-    data << uint8(rosterMemberData.Level);
-    data << uint8(rosterMemberData.ClassID);
-    data << uint8(rosterMemberData.Gender);
-    data << int32(rosterMemberData.AreaID);
-    if (!rosterMemberData.Status)
-        data << float(rosterMemberData.LastSave);
-
-    data << rosterMemberData.Note;
-    data << rosterMemberData.OfficerNote;
-
-    return data;
-}
-
 WorldPacket const* WorldPackets::Guild::GuildEvent::Write()
 {
     _worldPacket << uint8(Type);
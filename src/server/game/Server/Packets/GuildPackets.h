@@ -139,6 +139,9 @@ namespace WorldPackets
             std::vector<GuildRankData> RankData;
             std::string WelcomeText;
             std::string InfoText;
+
+            // filled by Write(), position of each member's Level in the packet, AreaID follows 3 bytes later
+            std::vector<std::size_t> MemberLevelPositions;
         };
 
         class GuildUpdateMotdText final : public ClientPacket
@@ -623,7 +626,6 @@ namespace WorldPackets
     }
 }
 
-ByteBuffer& operator<<(ByteBuffer& data, WorldPackets::Guild::GuildRosterMemberData const& rosterMemberData);
 ByteBuffer& operator<<(ByteBuffer& data, WorldPackets::Guild::GuildRankData const& rankData);
 
 #endif // GuildPackets_h__
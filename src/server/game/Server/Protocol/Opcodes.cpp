@@ -17,8 +17,10 @@
 
 #include "Opcodes.h"
 #include "Log.h"
+#include "Metric.h"
 #include "WorldSession.h"
 #include "Packets/AllPackets.h"
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
@@ -28,7 +30,8 @@ class PacketHandler : public ClientOpcodeHandler
 public:
     PacketHandler(char const* name, SessionStatus status, PacketProcessing processing) : ClientOpcodeHandler(name, status, processing) { }
 
-    void Call(WorldSession* session, WorldPacket& packet) const override
+protected:
+    void Handle(WorldSession* session, WorldPacket& packet) const override
     {
         PacketClass nicePacket(std::move(packet));
         nicePacket.Read();
@@ -42,7 +45,8 @@ class PacketHandler<WorldPacket, HandlerFunction> : public ClientOpcodeHandler
 public:
     PacketHandler(char const* name, SessionStatus status, PacketProcessing processing) : ClientOpcodeHandler(name, status, processing) { }
 
-    void Call(WorldSession* session, WorldPacket& packet) const override
+protected:
+    void Handle(WorldSession* session, WorldPacket& packet) const override
     {
         (session->*HandlerFunction)(packet);
     }
@@ -50,6 +54,57 @@ public:
 
 OpcodeTable opcodeTable;
 
+void OpcodeHandlerStats::Record(std::chrono::microseconds duration)
+{
+    uint64 time = std::max<int64>(duration.count(), 0);
+    Calls.fetch_add(1, std::memory_order_relaxed);
+    TotalTime.fetch_add(time, std::memory_order_relaxed);
+
+    uint64 maxTime = MaxTime.load(std::memory_order_relaxed);
+    while (time > maxTime && !MaxTime.compare_exchange_weak(maxTime, time, std::memory_order_relaxed))
+        ;
+
+    std::size_t bucket = 0;
+    while (time > 1 && bucket + 1 < LATENCY_BUCKETS)
+    {
+        time >>= 1;
+        ++bucket;
+    }
+
+    Histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64 OpcodeHandlerStats::GetPercentile(uint32 percentile) const
+{
+    uint64 calls = 0;
+    for (std::atomic<uint64> const& bucket : Histogram)
+        calls += bucket.load(std::memory_order_relaxed);
+
+    uint64 wanted = (calls * percentile + 99) / 100;
+    uint64 seen = 0;
+    for (std::size_t i = 0; i < LATENCY_BUCKETS; ++i)
+    {
+        seen += Histogram[i].load(std::memory_order_relaxed);
+        if (seen >= wanted && seen)
+            return UI64LIT(1) << (i + 1);
+    }
+
+    return 0;
+}
+
+void ClientOpcodeHandler::Call(WorldSession* session, WorldPacket& packet) const
+{
+    if (!opcodeTable.IsStatsEnabled())
+    {
+        Handle(session, packet);
+        return;
+    }
+
+    TimePoint start = std::chrono::steady_clock::now();
+    Handle(session, packet);
+    Stats.Record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+}
+
 template<typename T>
 struct get_packet_class
 {
@@ -61,9 +116,11 @@ struct get_packet_class<void(WorldSession::*)(PacketClass&)>
     using type = PacketClass;
 };
 
-OpcodeTable::OpcodeTable()
+OpcodeTable::OpcodeTable() : _statsEnabled(false)
 {
     memset(_internalTableClient, 0, sizeof(_internalTableClient));
+    _reportedCalls.fill(0);
+    _reportedTime.fill(0);
 }
 
 OpcodeTable::~OpcodeTable()
@@ -1466,6 +1523,52 @@ inline std::string GetOpcodeNameForLoggingImpl(T id)
     return ss.str();
 }
 
+std::vector<std::pair<Opcodes, ClientOpcodeHandler const*>> OpcodeTable::GetMostExpensiveHandlers(std::size_t limit) const
+{
+    std::vector<std::pair<Opcodes, ClientOpcodeHandler const*>> handlers;
+    for (uint16 i = 0; i < NUM_OPCODE_HANDLERS; ++i)
+        if (_internalTableClient[i] && _internalTableClient[i]->Stats.Calls.load(std::memory_order_relaxed))
+            handlers.emplace_back(Opcodes(i), _internalTableClient[i]);
+
+    auto byTotalTime = [](std::pair<Opcodes, ClientOpcodeHandler const*> const& left, std::pair<Opcodes, ClientOpcodeHandler const*> const& right)
+    {
+        return left.second->Stats.TotalTime.load(std::memory_order_relaxed) > right.second->Stats.TotalTime.load(std::memory_order_relaxed);
+    };
+
+    if (handlers.size() > limit)
+    {
+        std::partial_sort(handlers.begin(), handlers.begin() + limit, handlers.end(), byTotalTime);
+        handlers.resize(limit);
+    }
+    else
+        std::sort(handlers.begin(), handlers.end(), byTotalTime);
+
+    return handlers;
+}
+
+void OpcodeTable::LogMetrics()
+{
+    if (!IsStatsEnabled())
+        return;
+
+    for (uint16 i = 0; i < NUM_OPCODE_HANDLERS; ++i)
+    {
+        ClientOpcodeHandler const* handler = _internalTableClient[i];
+        if (!handler)
+            continue;
+
+        uint64 calls = handler->Stats.Calls.load(std::memory_order_relaxed);
+        if (calls == _reportedCalls[i])
+            continue;
+
+        uint64 time = handler->Stats.TotalTime.load(std::memory_order_relaxed);
+        TC_METRIC_VALUE("opcode_calls", calls - _reportedCalls[i], TC_METRIC_TAG("opcode", handler->Name));
+        TC_METRIC_VALUE("opcode_time", time - _reportedTime[i], TC_METRIC_TAG("opcode", handler->Name));
+        _reportedCalls[i] = calls;
+        _reportedTime[i] = time;
+    }
+}
+
 std::string GetOpcodeNameForLogging(Opcodes opcode)
 {
     return GetOpcodeNameForLoggingImpl(opcode);
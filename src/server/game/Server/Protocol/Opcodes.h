@@ -23,7 +23,11 @@
 #define _OPCODES_H
 
 #include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
 #include <string>
+#include <vector>
 
 enum Opcodes : uint16
 {
@@ -1380,15 +1384,37 @@ public:
     SessionStatus Status;
 };
 
+/// Dispatch cost of a client opcode handler, updated concurrently by world and map threads
+struct OpcodeHandlerStats
+{
+    /// Bucket i counts calls that took [2^i, 2^(i+1)) microseconds, the first and last buckets are open ended
+    static constexpr std::size_t LATENCY_BUCKETS = 20;
+
+    std::atomic<uint64> Calls;
+    std::atomic<uint64> TotalTime;                      // microseconds
+    std::atomic<uint64> MaxTime;                        // microseconds
+    std::array<std::atomic<uint64>, LATENCY_BUCKETS> Histogram;
+
+    void Record(std::chrono::microseconds duration);
+
+    /// Upper bound (in microseconds) of the bucket the given percentile (0-100) of calls falls into
+    uint64 GetPercentile(uint32 percentile) const;
+};
+
 class ClientOpcodeHandler : public OpcodeHandler
 {
 public:
     ClientOpcodeHandler(char const* name, SessionStatus status, PacketProcessing processing)
         : OpcodeHandler(name, status), ProcessingPlace(processing) { }
 
-    virtual void Call(WorldSession* session, WorldPacket& packet) const = 0;
+    /// Calls the handler, recording its cost when opcode stats are enabled
+    void Call(WorldSession* session, WorldPacket& packet) const;
 
     PacketProcessing ProcessingPlace;
+    mutable OpcodeHandlerStats Stats;
+
+protected:
+    virtual void Handle(WorldSession* session, WorldPacket& packet) const = 0;
 };
 
 class ServerOpcodeHandler : public OpcodeHandler
@@ -1415,6 +1441,15 @@ class OpcodeTable
             return _internalTableClient[index];
         }
 
+        void SetStatsEnabled(bool enabled) { _statsEnabled.store(enabled, std::memory_order_relaxed); }
+        bool IsStatsEnabled() const { return _statsEnabled.load(std::memory_order_relaxed); }
+
+        /// Returns handlers that were called at least once, most expensive (by total time) first
+        std::vector<std::pair<Opcodes, ClientOpcodeHandler const*>> GetMostExpensiveHandlers(std::size_t limit) const;
+
+        /// Sends calls and time spent per opcode since the previous call to Metric, world thread only
+        void LogMetrics();
+
     private:
         template<typename Handler, Handler HandlerFunction>
         void ValidateAndSetClientOpcode(OpcodeClient opcode, char const* name, SessionStatus status, PacketProcessing processing);
@@ -1422,6 +1457,10 @@ class OpcodeTable
         void ValidateAndSetServerOpcode(OpcodeServer opcode, char const* name, SessionStatus status);
 
         ClientOpcodeHandler* _internalTableClient[NUM_OPCODE_HANDLERS];
+
+        std::atomic<bool> _statsEnabled;
+        std::array<uint64, NUM_OPCODE_HANDLERS> _reportedCalls;
+        std::array<uint64, NUM_OPCODE_HANDLERS> _reportedTime;
 };
 
 extern OpcodeTable opcodeTable;
@@ -177,9 +177,8 @@ WorldSession::~WorldSession()
 
     delete _gameClient;
 
-    ///- empty incoming packet queue
-    WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    ///- empty incoming packet queue (_recvQueue deletes its own leftovers)
+    for (WorldPacket* packet : _pendingRecvPackets)
         delete packet;
 
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -269,7 +268,14 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
+}
+
+void WorldSession::DrainRecvQueue()
+{
+    WorldPacket* packet;
+    while (_recvQueue.Dequeue(packet))
+        _pendingRecvPackets.push_back(packet);
 }
 
 /// Logging helper for unexpected opcodes
@@ -310,8 +316,17 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 100;
 
-    while (m_Socket && _recvQueue.next(packet, updater))
+    DrainRecvQueue();
+
+    while (m_Socket && !_pendingRecvPackets.empty())
     {
+        packet = _pendingRecvPackets.front();
+        // packets this updater can't handle stay queued, in order, for the other one
+        if (!updater.Process(packet))
+            break;
+
+        _pendingRecvPackets.pop_front();
+
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
         TC_METRIC_DETAILED_TIMER("worldsession_update_opcode_time", TC_METRIC_TAG("opcode", opHandle->Name));
@@ -470,7 +485,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _pendingRecvPackets.insert(_pendingRecvPackets.begin(), requeuePackets.begin(), requeuePackets.end());
 
     if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
     {
@@ -27,11 +27,12 @@
 #include "AuthDefines.h"
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
-#include "LockedQueue.h"
+#include "MPSCQueue.h"
 #include "ObjectGuid.h"
 #include "Packet.h"
 #include "SharedDefines.h"
 #include <boost/circular_buffer_fwd.hpp>
+#include <deque>
 #include <string>
 #include <map>
 #include <memory>
@@ -1242,6 +1243,9 @@ class TC_GAME_API WorldSession
         void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char *reason);
         void LogUnprocessedTail(WorldPacket* packet);
 
+        /// Moves all packets queued by the network thread behind those left over from previous updates
+        void DrainRecvQueue();
+
         // EnumData helpers
         bool IsLegitCharacterForAccount(ObjectGuid lowGUID)
         {
@@ -1308,7 +1312,8 @@ class TC_GAME_API WorldSession
         } _addons;
         uint32 recruiterId;
         bool isRecruiter;
-        LockedQueue<WorldPacket*> _recvQueue;
+        MPSCQueue<WorldPacket> _recvQueue;              // filled lock-free by the network thread
+        std::deque<WorldPacket*> _pendingRecvPackets;   // only accessed by the thread currently updating this session
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
@@ -154,6 +154,8 @@ void WorldSocket::ReadHandler()
         return;
 
     MessageBuffer& packet = GetReadBuffer();
+
+    // every packet fully contained in this read is parsed in one pass, partial ones are staged in _headerBuffer/_packetBuffer
     while (packet.GetActiveSize() > 0)
     {
         if (_headerBuffer.GetRemainingSpace() > 0)
@@ -176,6 +178,16 @@ void WorldSocket::ReadHandler()
                 CloseSocket();
                 return;
             }
+
+            // whole payload already received - copy it straight into packet storage instead of resizing and filling _packetBuffer
+            std::size_t payloadSize = reinterpret_cast<ClientPktHeader const*>(_headerBuffer.GetReadPointer())->size;
+            if (packet.GetActiveSize() >= payloadSize)
+            {
+                _packetBuffer.Assign(packet.GetReadPointer(), payloadSize);
+                packet.ReadCompleted(payloadSize);
+            }
+            else
+                _packetBuffer.Resize(payloadSize);
         }
 
         // We have full read header, now check the data payload
@@ -195,6 +207,7 @@ void WorldSocket::ReadHandler()
         }
 
         // just received fresh new payload
+        OnPacketReceived();
         ReadDataHandlerResult result = ReadDataHandler();
         _headerBuffer.Reset();
         if (result != ReadDataHandlerResult::Ok)
@@ -228,7 +241,6 @@ bool WorldSocket::ReadHeaderHandler()
     }
 
     header->size -= sizeof(header->cmd);
-    _packetBuffer.Resize(header->size);
     return true;
 }
 
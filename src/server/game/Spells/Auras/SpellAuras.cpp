@@ -856,6 +856,25 @@ void Aura::Update(uint32 diff, Unit* caster)
     }
 }
 
+bool Aura::IsIdleForUpdate() const
+{
+    if (m_duration >= 0)
+        return false;
+
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+        if (m_effects[i] && m_effects[i]->IsPeriodic())
+            return false;
+
+    return true;
+}
+
+// idle auras are updated less often by their owner, make it sort this one again on its next update
+void Aura::_MarkOwnerAuraUpdateListsDirty()
+{
+    if (GetType() == UNIT_AURA_TYPE)
+        GetUnitOwner()->_MarkAuraUpdateListsDirty();
+}
+
 int32 Aura::CalcMaxDuration(Unit* caster) const
 {
     return Aura::CalcMaxDuration(GetSpellInfo(), caster);
@@ -891,6 +910,9 @@ void Aura::SetDuration(int32 duration, bool withMods)
             if (Player* modOwner = caster->GetSpellModOwner())
                 modOwner->ApplySpellMod(GetId(), SPELLMOD_DURATION, duration);
 
+    if (m_duration < 0 && duration >= 0)
+        _MarkOwnerAuraUpdateListsDirty();
+
     m_duration = duration;
     SetNeedClientUpdateForTargets();
 }
@@ -925,10 +947,14 @@ void Aura::RefreshTimers(bool resetPeriodicTimer)
     m_maxDuration = CalcMaxDuration();
     RefreshDuration();
 
+    bool const wasIdle = IsIdleForUpdate();
     Unit* caster = GetCaster();
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         if (AuraEffect* aurEff = m_effects[i])
             aurEff->CalculatePeriodic(caster, resetPeriodicTimer, false);
+
+    if (wasIdle && !IsIdleForUpdate())
+        _MarkOwnerAuraUpdateListsDirty();
 }
 
 void Aura::SetCharges(uint8 charges)
@@ -1210,6 +1236,8 @@ void Aura::SetLoadedState(int32 maxduration, int32 duration, int32 charges, uint
             aurEff->RecalculateAmount(caster);
         }
     }
+
+    _MarkOwnerAuraUpdateListsDirty();
 }
 
 bool Aura::HasEffectType(AuraType type) const
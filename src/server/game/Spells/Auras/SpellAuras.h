@@ -138,6 +138,8 @@ class TC_GAME_API Aura
 
         void UpdateOwner(uint32 diff, WorldObject* owner);
         void Update(uint32 diff, Unit* caster);
+        // permanent auras without periodic effects only need UpdateOwner to refresh their target map
+        bool IsIdleForUpdate() const;
 
         time_t GetApplyTime() const { return m_applyTime; }
         int32 GetMaxDuration() const { return m_maxDuration; }
@@ -281,6 +283,7 @@ class TC_GAME_API Aura
     private:
         AuraScript* GetScriptByName(std::string const& scriptName) const;
         void _DeleteRemovedApplications();
+        void _MarkOwnerAuraUpdateListsDirty();
 
     protected:
         SpellInfo const* const m_spellInfo;
@@ -194,7 +194,7 @@ public:
             return false;
         }
 
-        CharacterCacheEntry const* oldCaptainNameData = sCharacterCache->GetCharacterCacheByGuid(arena->GetCaptain());
+        Optional<CharacterCacheEntry> oldCaptainNameData = sCharacterCache->GetCharacterCacheByGuid(arena->GetCaptain());
         char const* oldCaptainName = oldCaptainNameData ? oldCaptainNameData->Name.c_str() : "<unknown>";
 
         arena->SetCaptain(target->GetGUID());
@@ -422,7 +422,7 @@ public:
         if (!player)
             return false;
 
-        CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(player->GetGUID());
+        Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(player->GetGUID());
         if (!characterInfo)
             return false;
 
@@ -488,7 +488,7 @@ public:
         if (!player)
             return false;
 
-        CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(player->GetGUID());
+        Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(player->GetGUID());
         if (!characterInfo)
         {
             handler->SendSysMessage(LANG_PLAYER_NOT_FOUND);
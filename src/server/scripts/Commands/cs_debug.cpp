@@ -119,6 +119,7 @@ public:
             { "asan outofbounds",   HandleDebugOutOfBounds,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "guidlimits",         HandleDebugGuidLimitsCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "objectcount",        HandleDebugObjectCountCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
+            { "opcodestats",        HandleDebugOpcodeStatsCommand,         rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "questreset",         HandleDebugQuestResetCommand,          rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes },
             { "warden force",       HandleDebugWardenForce,                rbac::RBAC_PERM_COMMAND_DEBUG,   Console::Yes }
         };
@@ -1769,6 +1770,26 @@ public:
         return true;
     }
 
+    static bool HandleDebugOpcodeStatsCommand(ChatHandler* handler, Optional<uint32> count)
+    {
+        if (!opcodeTable.IsStatsEnabled())
+        {
+            handler->SendSysMessage("Opcode stats are disabled, enable Network.OpcodeStats in worldserver.conf");
+            return true;
+        }
+
+        for (auto const& [opcode, opHandle] : opcodeTable.GetMostExpensiveHandlers(count.value_or(10)))
+        {
+            OpcodeHandlerStats const& stats = opHandle->Stats;
+            uint64 calls = stats.Calls.load(std::memory_order_relaxed);
+            uint64 totalTime = stats.TotalTime.load(std::memory_order_relaxed);
+            handler->PSendSysMessage("%s: calls " UI64FMTD " total " UI64FMTD " us avg " UI64FMTD " us p50 <" UI64FMTD " us p99 <" UI64FMTD " us max " UI64FMTD " us",
+                opHandle->Name, calls, totalTime, totalTime / calls, stats.GetPercentile(50), stats.GetPercentile(99), stats.MaxTime.load(std::memory_order_relaxed));
+        }
+
+        return true;
+    }
+
     class CreatureCountWorker
     {
     public:
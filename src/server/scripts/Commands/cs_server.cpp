@@ -43,6 +43,7 @@ EndScriptData */
 #include "VMapManager2.h"
 #include "World.h"
 #include "WorldSession.h"
+#include "WorldSocketMgr.h"
 #include <boost/filesystem/directory.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <openssl/crypto.h>
@@ -277,6 +278,17 @@ public:
         if (sWorld->IsShuttingDown())
             handler->PSendSysMessage(LANG_SHUTDOWN_TIMELEFT, secsToTimeString(sWorld->GetShutDownTimeLeft()).c_str());
 
+        // per network thread traffic is only interesting (and only shown) to those allowed to debug the server
+        if (handler->HasPermission(rbac::RBAC_PERM_COMMAND_SERVER_DEBUG))
+        {
+            for (int32 i = 0; i < sWorldSocketMgr.GetNetworkThreadCount(); ++i)
+            {
+                NetworkThreadStats stats = sWorldSocketMgr.GetNetworkThreadStats(i);
+                handler->PSendSysMessage("Network thread %d: %d connections, %u packets/s, " UI64FMTD " bytes/s received, " UI64FMTD " bytes/s sent",
+                    i, stats.Connections, stats.PacketsPerSecond, stats.BytesReceivedPerSecond, stats.BytesSentPerSecond);
+            }
+        }
+
         return true;
     }
     // Display the 'Message of the day' for the realm
@@ -47,6 +47,9 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
     if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
         _stringPool.push_back(stringBlock);
 
+    if (dbc.GetMappedFile())
+        _mappedFiles.push_back(dbc.GetMappedFile());
+
     // error in dbc file at loading if NULL
     return indexTable != nullptr;
 }
@@ -66,6 +69,10 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
         _stringPool.push_back(stringBlock);
 
+    // only needed if some string of this locale was used
+    if (dbc.GetMappedFile() && strchr(_fileFormat, FT_STRING))
+        _mappedFiles.push_back(dbc.GetMappedFile());
+
     return true;
 }
 
@@ -19,6 +19,7 @@
 #define DBCSTORE_H
 
 #include "Common.h"
+#include "DBCFileLoader.h"
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <vector>
@@ -47,6 +48,7 @@ class TC_SHARED_API DBCStorageBase
         char const* _fileFormat;
         char* _dataTable;
         std::vector<char*> _stringPool;
+        std::vector<DBCFileLoader::MappedFile> _mappedFiles;    // files records or strings point into
         uint32 _indexTableSize;
 };
 
@@ -23,6 +23,8 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "Metric.h"
+#include "Socket.h"
 #include "Timer.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <atomic>
@@ -30,16 +32,27 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <thread>
 
 using boost::asio::ip::tcp;
 
+/// Traffic handled by a network thread during the last full second
+struct NetworkThreadStats
+{
+    int32 Connections = 0;
+    uint32 PacketsPerSecond = 0;
+    uint64 BytesReceivedPerSecond = 0;
+    uint64 BytesSentPerSecond = 0;
+};
+
 template<class SocketType>
 class NetworkThread
 {
 public:
-    NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _ioContext(1),
-        _acceptSocket(_ioContext), _updateTimer(_ioContext)
+    NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _threadIndex(0), _ioContext(1),
+        _acceptSocket(_ioContext), _updateTimer(_ioContext),
+        _trafficStart(std::chrono::steady_clock::now()), _packetsPerSecond(0), _bytesReceivedPerSecond(0), _bytesSentPerSecond(0)
     {
     }
 
@@ -59,11 +72,12 @@ public:
         _ioContext.stop();
     }
 
-    bool Start()
+    bool Start(uint32 threadIndex)
     {
         if (_thread)
             return false;
 
+        _threadIndex = threadIndex;
         _thread = new std::thread(&NetworkThread::Run, this);
         return true;
     }
@@ -82,6 +96,17 @@ public:
         return _connections;
     }
 
+    /// Safe to call from any thread, values are refreshed once per second by the network thread itself
+    NetworkThreadStats GetStats() const
+    {
+        NetworkThreadStats stats;
+        stats.Connections = _connections;
+        stats.PacketsPerSecond = _packetsPerSecond;
+        stats.BytesReceivedPerSecond = _bytesReceivedPerSecond;
+        stats.BytesSentPerSecond = _bytesSentPerSecond;
+        return stats;
+    }
+
     virtual void AddSocket(std::shared_ptr<SocketType> sock)
     {
         std::lock_guard<std::mutex> lock(_newSocketsLock);
@@ -143,7 +168,9 @@ protected:
 
         _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> sock)
         {
-            if (!sock->Update())
+            bool keep = sock->Update();
+            _traffic += sock->ConsumeTrafficCounters();
+            if (!keep)
             {
                 if (sock->IsOpen())
                     sock->CloseSocket();
@@ -156,6 +183,34 @@ protected:
 
             return false;
         }), _sockets.end());
+
+        UpdateTrafficStats();
+    }
+
+    void UpdateTrafficStats()
+    {
+        TimePoint now = std::chrono::steady_clock::now();
+        Milliseconds elapsed = std::chrono::duration_cast<Milliseconds>(now - _trafficStart);
+        if (elapsed < 1s)
+            return;
+
+        uint64 elapsedMs = elapsed.count();
+        _packetsPerSecond = uint32(uint64(_traffic.PacketsReceived) * 1000 / elapsedMs);
+        _bytesReceivedPerSecond = _traffic.BytesReceived * 1000 / elapsedMs;
+        _bytesSentPerSecond = _traffic.BytesSent * 1000 / elapsedMs;
+
+        std::string threadTag = std::to_string(_threadIndex);
+        TC_METRIC_VALUE("network_packets_per_second", _packetsPerSecond.load(), TC_METRIC_TAG("thread", threadTag));
+        TC_METRIC_VALUE("network_bytes_received_per_second", _bytesReceivedPerSecond.load(), TC_METRIC_TAG("thread", threadTag));
+        TC_METRIC_VALUE("network_bytes_sent_per_second", _bytesSentPerSecond.load(), TC_METRIC_TAG("thread", threadTag));
+        if (_traffic.Reads)
+            TC_METRIC_VALUE("network_bytes_per_read", _traffic.BytesReceived / _traffic.Reads, TC_METRIC_TAG("thread", threadTag));
+        if (!_sockets.empty())
+            TC_METRIC_VALUE("network_write_calls_per_socket_per_second", double(_traffic.WriteCalls) * 1000.0 / elapsedMs / _sockets.size(),
+                TC_METRIC_TAG("thread", threadTag));
+
+        _traffic = SocketTrafficCounters();
+        _trafficStart = now;
     }
 
 private:
@@ -165,6 +220,7 @@ private:
     std::atomic<bool> _stopped;
 
     std::thread* _thread;
+    uint32 _threadIndex;
 
     SocketContainer _sockets;
 
@@ -174,6 +230,12 @@ private:
     Trinity::Asio::IoContext _ioContext;
     tcp::socket _acceptSocket;
     Trinity::Asio::DeadlineTimer _updateTimer;
+
+    SocketTrafficCounters _traffic;
+    TimePoint _trafficStart;
+    std::atomic<uint32> _packetsPerSecond;
+    std::atomic<uint64> _bytesReceivedPerSecond;
+    std::atomic<uint64> _bytesSentPerSecond;
 };
 
 #endif // NetworkThread_h__
@@ -21,19 +21,43 @@
 #include "MessageBuffer.h"
 #include "Log.h"
 #include <atomic>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <functional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/asio/ip/tcp.hpp>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// upper bound of queued buffers handed to a single gather write, well below IOV_MAX
+#define WRITE_GATHER_MAX_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
 #endif
 
+/// Traffic of one socket since the owning network thread last collected it
+struct SocketTrafficCounters
+{
+    uint64 BytesReceived = 0;
+    uint64 BytesSent = 0;
+    uint32 Reads = 0;
+    uint32 WriteCalls = 0;
+    uint32 PacketsReceived = 0;
+
+    SocketTrafficCounters& operator+=(SocketTrafficCounters const& right)
+    {
+        BytesReceived += right.BytesReceived;
+        BytesSent += right.BytesSent;
+        Reads += right.Reads;
+        WriteCalls += right.WriteCalls;
+        PacketsReceived += right.PacketsReceived;
+        return *this;
+    }
+};
+
 template<class T>
 class Socket : public std::enable_shared_from_this<T>
 {
@@ -103,7 +127,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -138,6 +162,9 @@ public:
 
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
+    /// Returns traffic counted since the previous call, used for per thread network stats
+    SocketTrafficCounters ConsumeTrafficCounters() { return std::exchange(_trafficCounters, SocketTrafficCounters()); }
+
     tcp::socket& underlying_stream()
     {
         return _socket;
@@ -148,6 +175,8 @@ protected:
 
     virtual void ReadHandler() = 0;
 
+    void OnPacketReceived() { ++_trafficCounters.PacketsReceived; }
+
     bool AsyncProcessQueue()
     {
         if (_isWritingAsync)
@@ -156,8 +185,9 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        GatherWriteBuffers();
+        ++_trafficCounters.WriteCalls;
+        _socket.async_write_some(_gatherBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
@@ -177,6 +207,42 @@ protected:
     }
 
 private:
+    /// Collects the front of the write queue into _gatherBuffers so it can be flushed with a single gather write
+    /// returns total amount of bytes collected
+    std::size_t GatherWriteBuffers()
+    {
+        _gatherBuffers.clear();
+
+        std::size_t bytes = 0;
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            if (_gatherBuffers.size() >= WRITE_GATHER_MAX_BUFFERS)
+                break;
+
+            _gatherBuffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+            bytes += buffer.GetActiveSize();
+        }
+
+        return bytes;
+    }
+
+    /// Drops fully written buffers from the write queue and advances the partially written one
+    void ConsumeWrittenBytes(std::size_t bytes)
+    {
+        while (bytes > 0 && !_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            if (bytes < buffer.GetActiveSize())
+            {
+                buffer.ReadCompleted(bytes);
+                return;
+            }
+
+            bytes -= buffer.GetActiveSize();
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, size_t transferredBytes)
     {
         if (error)
@@ -185,6 +251,8 @@ private:
             return;
         }
 
+        ++_trafficCounters.Reads;
+        _trafficCounters.BytesReceived += transferredBytes;
         _readBuffer.WriteCompleted(transferredBytes);
         ReadHandler();
     }
@@ -196,9 +264,8 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            _trafficCounters.BytesSent += transferedBytes;
+            ConsumeWrittenBytes(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -222,37 +289,36 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        // everything queued since the last flush goes out in one writev
+        std::size_t bytesToSend = GatherWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        ++_trafficCounters.WriteCalls;
+        std::size_t bytesSent = _socket.write_some(_gatherBuffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
+
+        _trafficCounters.BytesSent += bytesSent;
+        ConsumeWrittenBytes(bytesSent);
+        if (bytesSent < bytesToSend) // now n > 0
             return AsyncProcessQueue();
-        }
 
-        _writeQueue.pop();
         if (_closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -266,12 +332,14 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _gatherBuffers;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
 
     bool _isWritingAsync;
+    SocketTrafficCounters _trafficCounters;
 };
 
 #endif // __SOCKET_H__
@@ -22,6 +22,7 @@
 #include "Errors.h"
 #include "NetworkThread.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <algorithm>
 #include <memory>
 
 using boost::asio::ip::tcp;
@@ -64,7 +65,7 @@ public:
         ASSERT(_threads);
 
         for (int32 i = 0; i < _threadCount; ++i)
-            _threads[i].Start();
+            _threads[i].Start(i);
 
         _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
 
@@ -112,20 +113,51 @@ public:
 
     int32 GetNetworkThreadCount() const { return _threadCount; }
 
-    uint32 SelectThreadWithMinConnections() const
+    NetworkThreadStats GetNetworkThreadStats(uint32 threadIndex) const
     {
-        uint32 min = 0;
+        ASSERT(threadIndex < uint32(_threadCount));
+        return _threads[threadIndex].GetStats();
+    }
+
+    /// Picks the thread with the lowest load, where load is the packet rate the thread is handling
+    /// plus its connection count weighted by the average packet rate of a single connection.
+    /// Without traffic this is the same as picking the thread with fewest connections.
+    uint32 SelectThreadWithLowestLoad() const
+    {
+        uint64 totalPackets = 0;
+        uint64 totalConnections = 0;
+        for (int32 i = 0; i < _threadCount; ++i)
+        {
+            NetworkThreadStats stats = _threads[i].GetStats();
+            totalPackets += stats.PacketsPerSecond;
+            totalConnections += std::max(stats.Connections, 0);
+        }
+
+        double packetsPerConnection = totalConnections ? std::max(double(totalPackets) / totalConnections, 1.0) : 1.0;
+        auto getLoad = [&](int32 i)
+        {
+            NetworkThreadStats stats = _threads[i].GetStats();
+            return stats.PacketsPerSecond + stats.Connections * packetsPerConnection;
+        };
 
+        uint32 min = 0;
+        double minLoad = getLoad(0);
         for (int32 i = 1; i < _threadCount; ++i)
-            if (_threads[i].GetConnectionCount() < _threads[min].GetConnectionCount())
+        {
+            double load = getLoad(i);
+            if (load < minLoad)
+            {
                 min = i;
+                minLoad = load;
+            }
+        }
 
         return min;
     }
 
     std::pair<tcp::socket*, uint32> GetSocketForAccept()
     {
-        uint32 threadIndex = SelectThreadWithMinConnections();
+        uint32 threadIndex = SelectThreadWithLowestLoad();
         return std::make_pair(_threads[threadIndex].GetSocketForAccept(), threadIndex);
     }
 
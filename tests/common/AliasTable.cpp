@@ -0,0 +1,102 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AliasTable.h"
+#include "Random.h"
+#include <array>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("Distribution", "[AliasTable]")
+{
+    Trinity::AliasTable table({ 1.0, 0.0, 2.0, 3.0, 4.0, 0.0 });
+    REQUIRE(table.size() == 6);
+
+    constexpr uint32 Rolls = 200000;
+    std::array<uint32, 6> counts = { };
+    for (uint32 i = 0; i < Rolls; ++i)
+        ++counts[table.Roll()];
+
+    REQUIRE(counts[1] == 0);
+    REQUIRE(counts[5] == 0);
+    REQUIRE(counts[0] == Approx(Rolls * 0.1).epsilon(0.05));
+    REQUIRE(counts[2] == Approx(Rolls * 0.2).epsilon(0.05));
+    REQUIRE(counts[3] == Approx(Rolls * 0.3).epsilon(0.05));
+    REQUIRE(counts[4] == Approx(Rolls * 0.4).epsilon(0.05));
+}
+
+TEST_CASE("Single outcome", "[AliasTable]")
+{
+    Trinity::AliasTable table({ 0.0, 25.0 });
+    for (uint32 i = 0; i < 1000; ++i)
+        REQUIRE(table.Roll() == 1);
+}
+
+// Not run by default: compares rolling typical loot group shapes (a handful of
+// explicitly chanced entries plus a miss) with the chance list walk used before
+TEST_CASE("Loot group benchmark", "[AliasTable][.]")
+{
+    constexpr uint32 Rolls = 5000000;
+    std::vector<std::vector<double>> groups =
+    {
+        { 35.0, 35.0, 20.0, 10.0 },
+        { 1.0, 0.5, 0.5, 0.2, 0.1 },
+        { 12.0, 12.0, 12.0, 12.0, 12.0, 12.0, 12.0, 12.0 },
+        { 0.05, 0.05, 0.05, 0.02, 0.02, 0.02, 0.02, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01 }
+    };
+
+    for (std::vector<double> const& chances : groups)
+    {
+        std::vector<double> weights = chances;
+        double total = std::accumulate(chances.begin(), chances.end(), 0.0);
+        if (total < 100.0)
+            weights.push_back(100.0 - total);
+
+        Trinity::AliasTable table(weights);
+        uint64 aliasHits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < Rolls; ++i)
+            if (table.Roll() < chances.size())
+                ++aliasHits;
+        auto aliasTime = std::chrono::steady_clock::now() - start;
+
+        uint64 walkHits = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < Rolls; ++i)
+        {
+            double roll = rand_chance();
+            for (double chance : chances)
+            {
+                roll -= chance;
+                if (roll < 0)
+                {
+                    ++walkHits;
+                    break;
+                }
+            }
+        }
+        auto walkTime = std::chrono::steady_clock::now() - start;
+
+        WARN(chances.size() << " entries, " << total << "% total: alias "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(aliasTime).count() << " ms, list walk "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(walkTime).count() << " ms");
+        REQUIRE(double(aliasHits) == Approx(double(walkHits)).epsilon(0.05).margin(Rolls * 0.001));
+    }
+}
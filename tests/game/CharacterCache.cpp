@@ -0,0 +1,159 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CharacterCache.h"
+#include "SharedDefines.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // far above any guid a test database would hand out
+    ObjectGuid TestGuid(uint32 index) { return ObjectGuid::Create<HighGuid::Player>(0xF0000000 + index); }
+}
+
+TEST_CASE("Name lookups ignore case", "[CharacterCache]")
+{
+    ObjectGuid guid = TestGuid(1);
+    sCharacterCache->AddCharacterCacheEntry(guid, 42, "Testchar", GENDER_FEMALE, RACE_HUMAN, CLASS_MAGE, 80);
+
+    REQUIRE(sCharacterCache->GetCharacterGuidByName("Testchar") == guid);
+    REQUIRE(sCharacterCache->GetCharacterGuidByName("tESTCHAR") == guid);
+    REQUIRE(sCharacterCache->GetCharacterAccountIdByName("testchar") == 42);
+
+    Optional<CharacterCacheEntry> entry = sCharacterCache->GetCharacterCacheByName("TESTCHAR");
+    REQUIRE(entry.has_value());
+    REQUIRE(entry->Guid == guid);
+    REQUIRE(entry->Name == "Testchar");
+
+    sCharacterCache->DeleteCharacterCacheEntry(guid, "Testchar");
+    REQUIRE(sCharacterCache->GetCharacterGuidByName("Testchar").IsEmpty());
+    REQUIRE_FALSE(sCharacterCache->HasCharacterCacheEntry(guid));
+}
+
+TEST_CASE("Non latin names are folded", "[CharacterCache]")
+{
+    REQUIRE(CharacterCache::FoldName("Ärger") == CharacterCache::FoldName("äRGER"));
+    REQUIRE(CharacterCache::FoldName("Вася") == CharacterCache::FoldName("вАСЯ"));
+    REQUIRE(CharacterCache::FoldName("Вася") != CharacterCache::FoldName("Ваня"));
+}
+
+TEST_CASE("Updates are visible to lookups", "[CharacterCache]")
+{
+    ObjectGuid guid = TestGuid(2);
+    sCharacterCache->AddCharacterCacheEntry(guid, 7, "Leveler", GENDER_MALE, RACE_ORC, CLASS_WARRIOR, 1);
+    Optional<CharacterCacheEntry> before = sCharacterCache->GetCharacterCacheByGuid(guid);
+
+    sCharacterCache->UpdateCharacterLevel(guid, 80);
+    sCharacterCache->UpdateCharacterGuildId(guid, 1234);
+    sCharacterCache->UpdateCharacterAccountId(guid, 8);
+
+    REQUIRE(sCharacterCache->GetCharacterLevelByGuid(guid) == 80);
+    REQUIRE(sCharacterCache->GetCharacterGuildIdByGuid(guid) == 1234);
+    REQUIRE(sCharacterCache->GetCharacterAccountIdByName("Leveler") == 8);
+    REQUIRE(sCharacterCache->GetCharacterCacheByGuid(guid)->Level == 80);
+
+    // lookups return copies, later updates don't change what a caller already holds
+    REQUIRE(before.has_value());
+    REQUIRE(before->Level == 1);
+
+    sCharacterCache->DeleteCharacterCacheEntry(guid, "Leveler");
+}
+
+TEST_CASE("Concurrent lookups while entries change", "[CharacterCache]")
+{
+    constexpr uint32 STABLE_ENTRIES = 256;
+    for (uint32 i = 0; i < STABLE_ENTRIES; ++i)
+        sCharacterCache->AddCharacterCacheEntry(TestGuid(100 + i), i, "Stable" + std::to_string(i), GENDER_MALE, RACE_HUMAN, CLASS_PRIEST, 10);
+
+    std::atomic<bool> stop = false;
+    std::atomic<uint32> misses = 0;
+    std::vector<std::thread> readers;
+    for (uint32 t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!stop)
+                for (uint32 i = 0; i < STABLE_ENTRIES; ++i)
+                    if (sCharacterCache->GetCharacterGuidByName("stable" + std::to_string(i)) != TestGuid(100 + i))
+                        ++misses;
+        });
+    }
+
+    // other characters come and go meanwhile, touching the same shards
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        std::string name = "Churn" + std::to_string(i);
+        sCharacterCache->AddCharacterCacheEntry(TestGuid(1000 + i), 1, name, GENDER_MALE, RACE_DWARF, CLASS_HUNTER, 1);
+        sCharacterCache->UpdateCharacterLevel(TestGuid(1000 + i), 2);
+        sCharacterCache->DeleteCharacterCacheEntry(TestGuid(1000 + i), name);
+    }
+
+    stop = true;
+    for (std::thread& reader : readers)
+        reader.join();
+
+    REQUIRE(misses == 0);
+
+    for (uint32 i = 0; i < STABLE_ENTRIES; ++i)
+        sCharacterCache->DeleteCharacterCacheEntry(TestGuid(100 + i), "Stable" + std::to_string(i));
+}
+
+TEST_CASE("Name lookup throughput", "[CharacterCache][.benchmark]")
+{
+    constexpr uint32 ENTRIES = 10000;
+    constexpr uint32 LOOKUPS_PER_THREAD = 1000000;
+
+    std::vector<std::string> names;
+    for (uint32 i = 0; i < ENTRIES; ++i)
+    {
+        names.push_back("Bench" + std::to_string(i));
+        sCharacterCache->AddCharacterCacheEntry(TestGuid(100000 + i), 1, names.back(), GENDER_MALE, RACE_HUMAN, CLASS_ROGUE, 80);
+    }
+
+    uint32 threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<uint32> found = 0;
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            uint32 hits = 0;
+            for (uint32 i = 0; i < LOOKUPS_PER_THREAD; ++i)
+                if (!sCharacterCache->GetCharacterGuidByName(names[(i * 7919 + t) % ENTRIES]).IsEmpty())
+                    ++hits;
+            found += hits;
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    WARN(threadCount << " threads: " << uint64(threadCount * LOOKUPS_PER_THREAD / elapsed.count()) << " name lookups per second");
+    REQUIRE(found == threadCount * LOOKUPS_PER_THREAD);
+
+    for (uint32 i = 0; i < ENTRIES; ++i)
+        sCharacterCache->DeleteCharacterCacheEntry(TestGuid(100000 + i), names[i]);
+}